@@ -4,17 +4,28 @@
 #ifndef TAO_CONFIG_HPP
 #define TAO_CONFIG_HPP
 
+#include "config/access_error.hpp"
+#include "config/environment.hpp"
+#include "config/file_cache.hpp"
+#include "config/input_manifest.hpp"
 #include "config/key.hpp"
+#include "config/key_chain.hpp"
+#include "config/static_key.hpp"
+#include "config/sparse_traits.hpp"
 #include "config/value.hpp"
 
 #include "config/from_file.hpp"
 #include "config/from_files.hpp"
 #include "config/from_input.hpp"
+#include "config/from_plain.hpp"
 #include "config/from_string.hpp"
 #include "config/to_stream.hpp"
 
 #include "config/access.hpp"
+#include "config/access_batch.hpp"
 #include "config/assign.hpp"
+#include "config/bind.hpp"
+#include "config/bound_key.hpp"
 
 #include "config/parser.hpp"
 
@@ -5,9 +5,14 @@
 #define TAO_CONFIG_ACCESS_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
+#include "access_error.hpp"
 #include "key.hpp"
+#include "static_key.hpp"
 #include "value.hpp"
 
 #include "internal/json.hpp"
@@ -16,10 +21,7 @@
 namespace tao::config
 {
    template< template< typename... > class Traits >
-   [[nodiscard]] const json::basic_value< Traits >& access( const json::basic_value< Traits >& v, const key& k );
-
-   template< template< typename... > class Traits >
-   [[nodiscard]] const json::basic_value< Traits >& access_name( const json::basic_value< Traits >& v, const std::string& k, const key& p )
+   [[nodiscard]] const json::basic_value< Traits >& access_name( const json::basic_value< Traits >& v, const std::string_view k )
    {
       if( !v.is_object() ) {
          throw std::runtime_error( internal::strcat( "attempt to index non-object with \"", k, "\"" ) );
@@ -29,11 +31,11 @@ namespace tao::config
       if( j == v.get_object().end() ) {
          throw std::runtime_error( internal::strcat( "object index \"", k, "\" not found" ) );
       }
-      return access( j->second, p );
+      return j->second;
    }
 
    template< template< typename... > class Traits >
-   [[nodiscard]] const json::basic_value< Traits >& access_index( const json::basic_value< Traits >& v, const std::size_t n, const key& p )
+   [[nodiscard]] const json::basic_value< Traits >& access_index( const json::basic_value< Traits >& v, const std::size_t n )
    {
       if( !v.is_array() ) {
          throw std::runtime_error( internal::strcat( "attempt to index non-array with ", n ) );
@@ -41,22 +43,161 @@ namespace tao::config
       if( v.get_array().size() <= n ) {
          throw std::runtime_error( internal::strcat( "array index ", n, " out of bounds ", v.get_array().size() ) );
       }
-      return access( v.get_array()[ n ], p );
+      return v.get_array()[ n ];
+   }
+
+   template< template< typename... > class Traits, typename Iterator >
+   [[nodiscard]] const json::basic_value< Traits >& access( const json::basic_value< Traits >& v, Iterator begin, const Iterator end )
+   {
+      const json::basic_value< Traits >* r = &v;
+
+      for( ; begin != end; ++begin ) {
+         switch( begin->kind() ) {
+            case key_kind::name:
+               r = &access_name( *r, begin->get_name() );
+               continue;
+            case key_kind::index:
+               r = &access_index( *r, begin->get_index() );
+               continue;
+         }
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+      return *r;
    }
 
    template< template< typename... > class Traits >
    [[nodiscard]] const json::basic_value< Traits >& access( const json::basic_value< Traits >& v, const key& k )
    {
-      if( k.empty() ) {
-         return v;
+      return access( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits, std::size_t N >
+   [[nodiscard]] const json::basic_value< Traits >& access( const json::basic_value< Traits >& v, const static_key< N >& k )
+   {
+      return access( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] const json::basic_value< Traits >& access_name( const json::basic_value< Traits >& v, const std::string& k, const key& p )
+   {
+      return access( access_name( v, k ), p );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] const json::basic_value< Traits >& access_index( const json::basic_value< Traits >& v, const std::size_t n, const key& p )
+   {
+      return access( access_index( v, n ), p );
+   }
+
+   // The non-throwing variant of access(), on failure the error code says what went wrong
+   // and part is the index of the key part that could not be resolved; no message is built.
+
+   template< template< typename... > class Traits >
+   struct basic_try_access_result
+   {
+      const json::basic_value< Traits >* pointer = nullptr;
+      access_error error = access_error::success;
+      std::size_t part = 0;
+
+      [[nodiscard]] explicit operator bool() const noexcept
+      {
+         return pointer != nullptr;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >& operator*() const noexcept
+      {
+         assert( pointer != nullptr );
+         return *pointer;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >* operator->() const noexcept
+      {
+         assert( pointer != nullptr );
+         return pointer;
+      }
+   };
+
+   using try_access_result = basic_try_access_result< traits >;
+
+   namespace internal
+   {
+      template< template< typename... > class Traits >
+      [[nodiscard]] access_error try_access_name( const json::basic_value< Traits >*& r, const std::string_view k ) noexcept
+      {
+         if( !r->is_object() ) {
+            return access_error::not_an_object;
+         }
+         const auto j = r->get_object().find( k );
+
+         if( j == r->get_object().end() ) {
+            return access_error::name_not_found;
+         }
+         r = &j->second;
+         return access_error::success;
       }
-      switch( k[ 0 ].kind() ) {
-         case key_kind::name:
-            return access_name( v, k[ 0 ].get_name(), pop_front( k ) );
-         case key_kind::index:
-            return access_index( v, k[ 0 ].get_index(), pop_front( k ) );
+
+      template< template< typename... > class Traits >
+      [[nodiscard]] access_error try_access_index( const json::basic_value< Traits >*& r, const std::size_t n ) noexcept
+      {
+         if( !r->is_array() ) {
+            return access_error::not_an_array;
+         }
+         if( r->get_array().size() <= n ) {
+            return access_error::index_out_of_bounds;
+         }
+         r = &r->get_array()[ n ];
+         return access_error::success;
       }
-      throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+
+   }  // namespace internal
+
+   template< template< typename... > class Traits, typename Iterator >
+   [[nodiscard]] basic_try_access_result< Traits > try_access( const json::basic_value< Traits >& v, Iterator begin, const Iterator end ) noexcept
+   {
+      basic_try_access_result< Traits > result;
+      const json::basic_value< Traits >* r = &v;
+
+      for( ; begin != end; ++begin, ++result.part ) {
+         switch( begin->kind() ) {
+            case key_kind::name:
+               result.error = internal::try_access_name( r, begin->get_name() );
+               break;
+            case key_kind::index:
+               result.error = internal::try_access_index( r, begin->get_index() );
+               break;
+         }
+         if( result.error != access_error::success ) {
+            return result;
+         }
+      }
+      result.pointer = r;
+      return result;
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] basic_try_access_result< Traits > try_access( const json::basic_value< Traits >& v, const key& k ) noexcept
+   {
+      return try_access( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits, std::size_t N >
+   [[nodiscard]] basic_try_access_result< Traits > try_access( const json::basic_value< Traits >& v, const static_key< N >& k ) noexcept
+   {
+      return try_access( v, k.begin(), k.end() );
+   }
+
+   // Returns a pointer to the sub-value, or nullptr when the key can not be resolved.
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] const json::basic_value< Traits >* find( const json::basic_value< Traits >& v, const key& k ) noexcept
+   {
+      return try_access( v, k.begin(), k.end() ).pointer;
+   }
+
+   template< template< typename... > class Traits, std::size_t N >
+   [[nodiscard]] const json::basic_value< Traits >* find( const json::basic_value< Traits >& v, const static_key< N >& k ) noexcept
+   {
+      return try_access( v, k.begin(), k.end() ).pointer;
    }
 
 }  // namespace tao::config
@@ -0,0 +1,111 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_ACCESS_BATCH_HPP
+#define TAO_CONFIG_ACCESS_BATCH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "access.hpp"
+#include "key.hpp"
+#include "key_part.hpp"
+#include "value.hpp"
+
+#include "internal/json.hpp"
+
+namespace tao::config
+{
+   template< template< typename... > class Traits >
+   struct basic_access_result
+   {
+      const json::basic_value< Traits >* pointer = nullptr;
+      std::string error;
+
+      [[nodiscard]] explicit operator bool() const noexcept
+      {
+         return pointer != nullptr;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >& operator*() const noexcept
+      {
+         assert( pointer != nullptr );
+         return *pointer;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >* operator->() const noexcept
+      {
+         assert( pointer != nullptr );
+         return pointer;
+      }
+   };
+
+   using access_result = basic_access_result< traits >;
+
+   namespace internal
+   {
+      template< template< typename... > class Traits >
+      [[nodiscard]] const json::basic_value< Traits >& access_part( const json::basic_value< Traits >& v, const key_part& p )
+      {
+         switch( p.kind() ) {
+            case key_kind::name:
+               return access_name( v, p.get_name() );
+            case key_kind::index:
+               return access_index( v, p.get_index() );
+         }
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      // The indices in [b,e) refer to keys that are sorted and share their first d parts,
+      // which were already resolved to v; each distinct part at depth d is resolved once.
+
+      template< template< typename... > class Traits >
+      void access_batch( const json::basic_value< Traits >& v, const std::vector< key >& keys, const std::size_t* b, const std::size_t* const e, const std::size_t d, std::vector< basic_access_result< Traits > >& r )
+      {
+         for( ; ( b != e ) && ( keys[ *b ].size() == d ); ++b ) {
+            r[ *b ].pointer = &v;
+         }
+         while( b != e ) {
+            const key_part& p = keys[ *b ][ d ];
+            const std::size_t* const m = std::find_if( b + 1, e, [ & ]( const std::size_t i ) { return !( keys[ i ][ d ] == p ); } );
+            const json::basic_value< Traits >* c = nullptr;
+            try {
+               c = &access_part( v, p );
+            }
+            catch( const std::runtime_error& x ) {
+               for( ; b != m; ++b ) {
+                  r[ *b ].error = x.what();
+               }
+               continue;
+            }
+            access_batch( *c, keys, b, m, d + 1, r );
+            b = m;
+         }
+      }
+
+   }  // namespace internal
+
+   // Resolves all keys in a single traversal of v, keys with common prefixes share the lookups
+   // of the common parts. The results are in the same order as the keys, failed lookups have a
+   // null pointer and the message of the exception that access() would have thrown as error.
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] std::vector< basic_access_result< Traits > > access_batch( const json::basic_value< Traits >& v, const std::vector< key >& keys )
+   {
+      std::vector< std::size_t > order( keys.size() );
+      std::iota( order.begin(), order.end(), std::size_t( 0 ) );
+      std::sort( order.begin(), order.end(), [ & ]( const std::size_t l, const std::size_t r ) { return keys[ l ] < keys[ r ]; } );
+
+      std::vector< basic_access_result< Traits > > result( keys.size() );
+      internal::access_batch( v, keys, order.data(), order.data() + order.size(), 0, result );
+      return result;
+   }
+
+}  // namespace tao::config
+
+#endif
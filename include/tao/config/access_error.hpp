@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_ACCESS_ERROR_HPP
+#define TAO_CONFIG_ACCESS_ERROR_HPP
+
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+
+namespace tao::config
+{
+   enum class access_error : char
+   {
+      success = 0,
+      not_an_object = 1,
+      name_not_found = 2,
+      not_an_array = 3,
+      index_out_of_bounds = 4
+   };
+
+   [[nodiscard]] constexpr std::string_view to_string( const access_error e )
+   {
+      switch( e ) {
+         case access_error::success:
+            return "success";
+         case access_error::not_an_object:
+            return "attempt to index non-object with name";
+         case access_error::name_not_found:
+            return "object index not found";
+         case access_error::not_an_array:
+            return "attempt to index non-array with index";
+         case access_error::index_out_of_bounds:
+            return "array index out of bounds";
+      }
+      throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+   }
+
+   inline std::ostream& operator<<( std::ostream& o, const access_error e )
+   {
+      return o << to_string( e );
+   }
+
+}  // namespace tao::config
+
+#endif
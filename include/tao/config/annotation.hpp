@@ -12,12 +12,13 @@
 #include <tao/pegtl/position.hpp>
 
 #include "key.hpp"
+#include "key_chain.hpp"
 
 namespace tao::config
 {
    struct annotation
    {
-      config::key key;
+      key_chain key;
       json::position position;  // TODO: json::position, pegtl::position or TBD config::position?
 
       annotation() = default;
@@ -28,11 +29,16 @@ namespace tao::config
       annotation( const annotation& ) = default;
       annotation& operator=( const annotation& ) = default;
 
-      void set_key( config::key k ) noexcept
+      void set_key( key_chain k ) noexcept
       {
          key = std::move( k );
       }
 
+      void set_key( const config::key& k )
+      {
+         key = key_chain( k );
+      }
+
       void set_position( json::position p ) noexcept
       {
          position = std::move( p );
@@ -0,0 +1,83 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_ANNOTATION_TABLE_HPP
+#define TAO_CONFIG_ANNOTATION_TABLE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <tao/pegtl/position.hpp>
+
+#include "key_chain.hpp"
+
+namespace tao::config
+{
+   // The side table for sparse annotations with key and position for all values of one config.
+   // Positions are packed into 32-bit line and column numbers plus an index into the list of
+   // distinct source names; the byte offset is not kept since error messages do not use it.
+
+   class annotation_table
+   {
+   public:
+      [[nodiscard]] std::uint32_t add( const key_chain& k, const pegtl::position& p )
+      {
+         if( ( m_entries.size() >= max ) || ( p.line > max ) || ( p.column > max ) ) {
+            throw std::length_error( "too many values or lines for annotation table" );  // LCOV_EXCL_LINE
+         }
+         const auto [ i, b ] = m_source_index.try_emplace( p.source, std::uint32_t( m_sources.size() ) );
+         if( b ) {
+            m_sources.emplace_back( &i->first );
+         }
+         m_entries.push_back( { k, std::uint32_t( p.line ), std::uint32_t( p.column ), i->second } );
+         return std::uint32_t( m_entries.size() - 1 );
+      }
+
+      [[nodiscard]] std::size_t size() const noexcept
+      {
+         return m_entries.size();
+      }
+
+      [[nodiscard]] std::size_t sources() const noexcept
+      {
+         return m_sources.size();
+      }
+
+      [[nodiscard]] const key_chain& key( const std::uint32_t i ) const noexcept
+      {
+         assert( i < m_entries.size() );
+         return m_entries[ i ].key;
+      }
+
+      [[nodiscard]] pegtl::position position( const std::uint32_t i ) const
+      {
+         assert( i < m_entries.size() );
+         const auto& e = m_entries[ i ];
+         return pegtl::position( 0, e.line, e.column, *m_sources[ e.source ] );
+      }
+
+   private:
+      static constexpr std::size_t max = std::numeric_limits< std::uint32_t >::max();
+
+      struct entry
+      {
+         key_chain key;
+         std::uint32_t line;
+         std::uint32_t column;
+         std::uint32_t source;
+      };
+
+      std::vector< entry > m_entries;
+      std::vector< const std::string* > m_sources;  // Points to the keys of m_source_index.
+      std::unordered_map< std::string, std::uint32_t > m_source_index;
+   };
+
+}  // namespace tao::config
+
+#endif
@@ -5,9 +5,14 @@
 #define TAO_CONFIG_ASSIGN_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
+#include "access_error.hpp"
 #include "key.hpp"
+#include "static_key.hpp"
 #include "value.hpp"
 
 #include "internal/json.hpp"
@@ -16,20 +21,21 @@
 namespace tao::config
 {
    template< template< typename... > class Traits >
-   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const key& k );
-
-   template< template< typename... > class Traits >
-   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const std::string& k, const key& p )
+   [[nodiscard]] json::basic_value< Traits >& assign_name( json::basic_value< Traits >& v, const std::string_view k )
    {
       if( !v.is_object() ) {
          throw std::runtime_error( internal::strcat( "attempt to index non-object with \"", k, "\"" ) );
       }
-      const auto t = v.get_object().try_emplace( k, json::empty_object );  // TODO: Detect empty_array vs. empty_object?
-      return assign( t.first->second, p );
+      auto& o = v.get_object();
+
+      if( const auto j = o.find( k ); j != o.end() ) {
+         return j->second;
+      }
+      return o.emplace( std::string( k ), json::empty_object ).first->second;  // TODO: Detect empty_array vs. empty_object?
    }
 
    template< template< typename... > class Traits >
-   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const std::size_t n, const key& p )
+   [[nodiscard]] json::basic_value< Traits >& assign_index( json::basic_value< Traits >& v, const std::size_t n )
    {
       if( !v.is_array() ) {
          throw std::runtime_error( internal::strcat( "attempt to index non-array with ", n ) );
@@ -37,22 +43,149 @@ namespace tao::config
       if( v.get_array().size() <= n ) {
          throw std::runtime_error( internal::strcat( "array index ", n, " out of bounds ", v.get_array().size() ) );
       }
-      return assign( v.get_array()[ n ], p );
+      return v.get_array()[ n ];
+   }
+
+   template< template< typename... > class Traits, typename Iterator >
+   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, Iterator begin, const Iterator end )
+   {
+      json::basic_value< Traits >* r = &v;
+
+      for( ; begin != end; ++begin ) {
+         switch( begin->kind() ) {
+            case key_kind::name:
+               r = &assign_name( *r, begin->get_name() );
+               continue;
+            case key_kind::index:
+               r = &assign_index( *r, begin->get_index() );
+               continue;
+         }
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+      return *r;
    }
 
    template< template< typename... > class Traits >
    [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const key& k )
    {
-      if( k.empty() ) {
-         return v;
+      return assign( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits, std::size_t N >
+   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const static_key< N >& k )
+   {
+      return assign( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const std::string& k, const key& p )
+   {
+      return assign( assign_name( v, k ), p );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits >& assign( json::basic_value< Traits >& v, const std::size_t n, const key& p )
+   {
+      return assign( assign_index( v, n ), p );
+   }
+
+   // The non-throwing variant of assign(), missing object members are still created, on failure
+   // the error code says what went wrong and part is the index of the key part that failed.
+
+   template< template< typename... > class Traits >
+   struct basic_try_assign_result
+   {
+      json::basic_value< Traits >* pointer = nullptr;
+      access_error error = access_error::success;
+      std::size_t part = 0;
+
+      [[nodiscard]] explicit operator bool() const noexcept
+      {
+         return pointer != nullptr;
+      }
+
+      [[nodiscard]] json::basic_value< Traits >& operator*() const noexcept
+      {
+         assert( pointer != nullptr );
+         return *pointer;
+      }
+
+      [[nodiscard]] json::basic_value< Traits >* operator->() const noexcept
+      {
+         assert( pointer != nullptr );
+         return pointer;
+      }
+   };
+
+   using try_assign_result = basic_try_assign_result< traits >;
+
+   namespace internal
+   {
+      template< template< typename... > class Traits >
+      [[nodiscard]] access_error try_assign_name( json::basic_value< Traits >*& r, const std::string_view k )
+      {
+         if( !r->is_object() ) {
+            return access_error::not_an_object;
+         }
+         auto& o = r->get_object();
+
+         if( const auto j = o.find( k ); j != o.end() ) {
+            r = &j->second;
+         }
+         else {
+            r = &o.emplace( std::string( k ), json::empty_object ).first->second;
+         }
+         return access_error::success;
       }
-      switch( k[ 0 ].kind() ) {
-         case key_kind::name:
-            return assign( v, k[ 0 ].get_name(), pop_front( k ) );
-         case key_kind::index:
-            return assign( v, k[ 0 ].get_index(), pop_front( k ) );
+
+      template< template< typename... > class Traits >
+      [[nodiscard]] access_error try_assign_index( json::basic_value< Traits >*& r, const std::size_t n ) noexcept
+      {
+         if( !r->is_array() ) {
+            return access_error::not_an_array;
+         }
+         if( r->get_array().size() <= n ) {
+            return access_error::index_out_of_bounds;
+         }
+         r = &r->get_array()[ n ];
+         return access_error::success;
       }
-      throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+
+   }  // namespace internal
+
+   template< template< typename... > class Traits, typename Iterator >
+   [[nodiscard]] basic_try_assign_result< Traits > try_assign( json::basic_value< Traits >& v, Iterator begin, const Iterator end )
+   {
+      basic_try_assign_result< Traits > result;
+      json::basic_value< Traits >* r = &v;
+
+      for( ; begin != end; ++begin, ++result.part ) {
+         switch( begin->kind() ) {
+            case key_kind::name:
+               result.error = internal::try_assign_name( r, begin->get_name() );
+               break;
+            case key_kind::index:
+               result.error = internal::try_assign_index( r, begin->get_index() );
+               break;
+         }
+         if( result.error != access_error::success ) {
+            return result;
+         }
+      }
+      result.pointer = r;
+      return result;
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] basic_try_assign_result< Traits > try_assign( json::basic_value< Traits >& v, const key& k )
+   {
+      return try_assign( v, k.begin(), k.end() );
+   }
+
+   template< template< typename... > class Traits, std::size_t N >
+   [[nodiscard]] basic_try_assign_result< Traits > try_assign( json::basic_value< Traits >& v, const static_key< N >& k )
+   {
+      return try_assign( v, k.begin(), k.end() );
    }
 
 }  // namespace tao::config
@@ -0,0 +1,192 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_BIND_HPP
+#define TAO_CONFIG_BIND_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "value.hpp"
+
+#include "internal/json.hpp"
+#include "internal/string_utility.hpp"
+
+namespace tao::config
+{
+   template< typename C, typename T >
+   struct field_t
+   {
+      std::string_view name;
+      T C::*member;
+      bool required;
+   };
+
+   template< typename C, typename T >
+   [[nodiscard]] constexpr field_t< C, T > field( const std::string_view name, T C::*member ) noexcept
+   {
+      return { name, member, true };
+   }
+
+   template< typename C, typename T >
+   [[nodiscard]] constexpr field_t< C, T > optional_field( const std::string_view name, T C::*member ) noexcept
+   {
+      return { name, member, false };
+   }
+
+   // Specialise for user structs with a static constexpr tuple of field descriptors called fields,
+   // and optionally a static constexpr bool ignore_unknown to silently skip unknown object members.
+
+   template< typename T >
+   struct bind_traits
+   {};
+
+   template< typename T, template< typename... > class Traits >
+   void bind( const json::basic_value< Traits >& v, T& t );
+
+   namespace internal
+   {
+      template< typename T, typename = void >
+      inline constexpr bool has_bind_fields = false;
+
+      template< typename T >
+      inline constexpr bool has_bind_fields< T, decltype( (void)bind_traits< T >::fields ) > = true;
+
+      template< typename T, typename = void >
+      inline constexpr bool bind_ignore_unknown = false;
+
+      template< typename T >
+      inline constexpr bool bind_ignore_unknown< T, decltype( (void)bind_traits< T >::ignore_unknown ) > = bind_traits< T >::ignore_unknown;
+
+      template< typename T >
+      inline constexpr bool is_bind_vector = false;
+
+      template< typename T >
+      inline constexpr bool is_bind_optional = false;
+
+      template< typename T >
+      inline constexpr bool is_bindable = has_bind_fields< T > || is_bind_vector< T > || is_bind_optional< T >;
+
+      template< typename T >
+      inline constexpr bool is_bind_vector< std::vector< T > > = is_bindable< T >;
+
+      template< typename T >
+      inline constexpr bool is_bind_optional< std::optional< T > > = is_bindable< T >;
+
+      template< typename V, typename = void >
+      inline constexpr bool has_append_message_extension = false;
+
+      template< typename V >
+      inline constexpr bool has_append_message_extension< V, decltype( std::declval< const V& >().public_base().append_message_extension( std::declval< std::ostream& >() ), void() ) > = true;
+
+      template< template< typename... > class Traits >
+      [[noreturn]] void throw_bind_error( const std::string& message, [[maybe_unused]] const json::basic_value< Traits >& v )
+      {
+         std::ostringstream oss;
+         oss << message;
+         if constexpr( has_append_message_extension< json::basic_value< Traits > > ) {
+            oss << ' ';
+            v.public_base().append_message_extension( oss );
+         }
+         throw std::runtime_error( std::move( oss ).str() );
+      }
+
+      template< std::size_t I, typename T, typename F, template< typename... > class Traits, std::size_t N >
+      [[nodiscard]] bool bind_field( const std::string& name, const json::basic_value< Traits >& v, T& t, const F& f, std::array< bool, N >& seen )
+      {
+         if( name != f.name ) {
+            return false;
+         }
+         config::bind( v, t.*( f.member ) );
+         seen[ I ] = true;
+         return true;
+      }
+
+      template< typename F, template< typename... > class Traits >
+      void bind_check( const bool seen, const F& f, const json::basic_value< Traits >& v )
+      {
+         if( f.required && !seen ) {
+            throw_bind_error( strcat( "missing required member \"", f.name, "\"" ), v );
+         }
+      }
+
+      template< typename T, template< typename... > class Traits, std::size_t... Is >
+      void bind_object( const json::basic_value< Traits >& v, [[maybe_unused]] T& t, std::index_sequence< Is... > /*unused*/ )
+      {
+         if( !v.is_object() ) {
+            throw_bind_error( strcat( "invalid json type '", v.type(), "' for binding to object" ), v );
+         }
+         [[maybe_unused]] const auto& fields = bind_traits< T >::fields;
+         std::array< bool, sizeof...( Is ) > seen = {};
+
+         for( const auto& [ name, member ] : v.get_object() ) {
+            const bool found = ( bind_field< Is >( name, member, t, std::get< Is >( fields ), seen ) || ... );
+
+            if constexpr( !bind_ignore_unknown< T > ) {
+               if( !found ) {
+                  throw_bind_error( strcat( "unknown member \"", name, "\"" ), member );
+               }
+            }
+         }
+         ( bind_check( seen[ Is ], std::get< Is >( fields ), v ), ... );
+      }
+
+      template< typename T, template< typename... > class Traits >
+      void bind_object( const json::basic_value< Traits >& v, T& t )
+      {
+         using fields_t = std::decay_t< decltype( bind_traits< T >::fields ) >;
+         bind_object( v, t, std::make_index_sequence< std::tuple_size_v< fields_t > >() );
+      }
+
+   }  // namespace internal
+
+   template< typename T, template< typename... > class Traits >
+   void bind( const json::basic_value< Traits >& v, T& t )
+   {
+      if constexpr( internal::has_bind_fields< T > ) {
+         internal::bind_object( v, t );
+      }
+      else if constexpr( internal::is_bind_vector< T > ) {
+         if( !v.is_array() ) {
+            internal::throw_bind_error( internal::strcat( "invalid json type '", v.type(), "' for binding to array" ), v );
+         }
+         t.clear();
+         t.reserve( v.get_array().size() );
+         for( const auto& e : v.get_array() ) {
+            config::bind( e, t.emplace_back() );
+         }
+      }
+      else if constexpr( internal::is_bind_optional< T > ) {
+         if( v.is_null() ) {
+            t.reset();
+         }
+         else {
+            config::bind( v, t.emplace() );
+         }
+      }
+      else {
+         t = v.template as< T >();
+      }
+   }
+
+   template< typename T, template< typename... > class Traits >
+   [[nodiscard]] T bind( const json::basic_value< Traits >& v )
+   {
+      T t{};
+      config::bind( v, t );
+      return t;
+   }
+
+}  // namespace tao::config
+
+#endif
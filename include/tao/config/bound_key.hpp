@@ -0,0 +1,110 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_BOUND_KEY_HPP
+#define TAO_CONFIG_BOUND_KEY_HPP
+
+#include <cassert>
+#include <string>
+#include <utility>
+
+#include "access.hpp"
+#include "key.hpp"
+#include "value.hpp"
+
+#include "internal/json.hpp"
+
+namespace tao::config
+{
+   // A key that is parsed once and resolved once per root value; subsequent
+   // lookups against the same root return the cached pointer without walking
+   // the value. The cached pointer is only valid as long as the root value is
+   // neither destroyed nor modified, call bind() again after changing it.
+   // Roots are only told apart by their address, a different root at the same
+   // address, e.g. a new config assigned to the same variable or allocated in
+   // place of a destroyed one, is not detected; call bind() or unbind() when
+   // a root is replaced.
+
+   template< template< typename... > class Traits >
+   class basic_bound_key
+   {
+   public:
+      explicit basic_bound_key( config::key k ) noexcept
+         : m_key( std::move( k ) )
+      {}
+
+      explicit basic_bound_key( const std::string& s )
+         : m_key( s )
+      {}
+
+      basic_bound_key( const json::basic_value< Traits >& root, config::key k )
+         : m_key( std::move( k ) )
+      {
+         bind( root );
+      }
+
+      basic_bound_key( const json::basic_value< Traits >& root, const std::string& s )
+         : m_key( s )
+      {
+         bind( root );
+      }
+
+      void bind( const json::basic_value< Traits >& root )
+      {
+         unbind();
+         m_value = &access( root, m_key );
+         m_root = &root;
+      }
+
+      void unbind() noexcept
+      {
+         m_root = nullptr;
+         m_value = nullptr;
+      }
+
+      [[nodiscard]] bool is_bound() const noexcept
+      {
+         return m_value != nullptr;
+      }
+
+      [[nodiscard]] bool is_bound_to( const json::basic_value< Traits >& root ) const noexcept
+      {
+         return m_root == &root;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >& get() const noexcept
+      {
+         assert( m_value != nullptr );
+         return *m_value;
+      }
+
+      [[nodiscard]] const json::basic_value< Traits >& get( const json::basic_value< Traits >& root )
+      {
+         if( m_root != &root ) {
+            bind( root );
+         }
+         return *m_value;
+      }
+
+      [[nodiscard]] const config::key& key() const noexcept
+      {
+         return m_key;
+      }
+
+   private:
+      config::key m_key;
+      const json::basic_value< Traits >* m_root = nullptr;
+      const json::basic_value< Traits >* m_value = nullptr;
+   };
+
+   using bound_key = basic_bound_key< traits >;
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] const json::basic_value< Traits >& access( const json::basic_value< Traits >& v, basic_bound_key< Traits >& k )
+   {
+      return k.get( v );
+   }
+
+}  // namespace tao::config
+
+#endif
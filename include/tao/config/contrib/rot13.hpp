@@ -4,14 +4,14 @@
 #ifndef TAO_CONFIG_CONTRIB_ROT13_HPP
 #define TAO_CONFIG_CONTRIB_ROT13_HPP
 
-#include <string>
+#include <string_view>
 
 #include "../internal/atom.hpp"
 #include "../internal/pegtl.hpp"
 
 namespace tao::config
 {
-   [[nodiscard]] inline internal::string_t rot13( const pegtl::position& pos, const std::string& in )
+   [[nodiscard]] inline internal::string_t rot13( const pegtl::position& pos, const std::string_view in )
    {
       internal::string_t out( in, pos );
 
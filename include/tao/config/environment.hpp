@@ -0,0 +1,72 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_ENVIRONMENT_HPP
+#define TAO_CONFIG_ENVIRONMENT_HPP
+
+#include <stdlib.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#if !defined( _MSC_VER )
+extern char** environ;
+#endif
+
+namespace tao::config
+{
+   // An immutable set of environment variables for the env and env? functions. Unless a parser
+   // is given an environment it takes a snapshot of the process environment on the first lookup,
+   // so that all lookups of a parser are consistent, independent of later changes to the process
+   // environment, and do not call getenv(). Taking the snapshot reads the process environment and
+   // must, like getenv(), not race with setenv() or putenv(). Tests can inject arbitrary variables.
+
+   class environment
+   {
+   public:
+      using map_t = std::unordered_map< std::string, std::string >;
+
+      environment() = default;
+
+      explicit environment( map_t variables ) noexcept
+         : m_variables( std::move( variables ) )
+      {}
+
+      [[nodiscard]] static std::shared_ptr< const environment > snapshot()
+      {
+         map_t variables;
+#if defined( _MSC_VER )
+         char** p = _environ;
+#else
+         char** p = environ;
+#endif
+         for( ; ( p != nullptr ) && ( *p != nullptr ); ++p ) {
+            // Skip the first character for the Windows entries like "=C:=C:\".
+            if( const char* s = ( **p != '\0' ) ? std::strchr( *p + 1, '=' ) : nullptr ) {
+               variables.try_emplace( std::string( *p, std::size_t( s - *p ) ), s + 1 );
+            }
+         }
+         return std::make_shared< const environment >( std::move( variables ) );
+      }
+
+      [[nodiscard]] const std::string* find( const std::string& name ) const noexcept
+      {
+         const auto i = m_variables.find( name );
+         return ( i == m_variables.end() ) ? nullptr : &i->second;
+      }
+
+      [[nodiscard]] const map_t& variables() const noexcept
+      {
+         return m_variables;
+      }
+
+   private:
+      map_t m_variables;
+   };
+
+}  // namespace tao::config
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_FILE_CACHE_HPP
+#define TAO_CONFIG_FILE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "internal/system_utility.hpp"
+
+namespace tao::config
+{
+   // Caches the contents of included and parsed files by canonical path, an entry is
+   // re-used as long as the modification time and size of the file are unchanged. One
+   // cache can be shared by multiple parsers, also from multiple threads. Only the file
+   // contents are shared, every include is still parsed by the including parser since
+   // the result depends on the position of the include and the preceding config.
+
+   class file_cache
+   {
+   public:
+      file_cache() = default;
+
+      file_cache( file_cache&& ) = delete;
+      file_cache( const file_cache& ) = delete;
+
+      ~file_cache() = default;
+
+      void operator=( file_cache&& ) = delete;
+      void operator=( const file_cache& ) = delete;
+
+      // Throws a std::system_error, e.g. a std::filesystem::filesystem_error, when the file can not be read.
+
+      [[nodiscard]] std::shared_ptr< const std::string > get( const std::filesystem::path& path )
+      {
+         const std::filesystem::path canonical = std::filesystem::canonical( path );
+         const auto mtime = std::filesystem::last_write_time( canonical );
+         const auto size = std::filesystem::file_size( canonical );
+         {
+            const std::lock_guard< std::mutex > lock( m_mutex );
+            if( const auto i = m_entries.find( canonical ); ( i != m_entries.end() ) && ( i->second.mtime == mtime ) && ( i->second.size == size ) ) {
+               ++m_hits;
+               return i->second.data;
+            }
+         }
+         auto data = std::make_shared< const std::string >( internal::read_file_throws( canonical.string() ) );
+
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         ++m_misses;
+         m_entries.insert_or_assign( canonical, entry{ mtime, size, data } );
+         return data;
+      }
+
+      [[nodiscard]] std::size_t size() const
+      {
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         return m_entries.size();
+      }
+
+      [[nodiscard]] std::uint64_t hits() const
+      {
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         return m_hits;
+      }
+
+      [[nodiscard]] std::uint64_t misses() const
+      {
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         return m_misses;
+      }
+
+      void clear()
+      {
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         m_entries.clear();
+      }
+
+   private:
+      struct entry
+      {
+         std::filesystem::file_time_type mtime;
+         std::uintmax_t size;
+         std::shared_ptr< const std::string > data;
+      };
+
+      mutable std::mutex m_mutex;
+      std::map< std::filesystem::path, entry > m_entries;
+      std::uint64_t m_hits = 0;
+      std::uint64_t m_misses = 0;
+   };
+
+}  // namespace tao::config
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_FROM_PLAIN_HPP
+#define TAO_CONFIG_FROM_PLAIN_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "internal/config_parser.hpp"
+#include "internal/pegtl.hpp"
+#include "internal/plain_parser.hpp"
+#include "internal/system_utility.hpp"
+#include "value.hpp"
+
+namespace tao::config
+{
+   // Plain config files use none of references, functions, asterisks, additions, appends,
+   // array indices in keys, delete, include or temporary, i.e. they are JAXN with dotted keys.
+   // They are parsed directly into the final value without the phases of the full pipeline.
+
+   enum class plain_mode : bool
+   {
+      detect,  // Falls back to the full pipeline when the input is not plain.
+      require  // Throws an exception when the input is not plain.
+   };
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits > basic_from_plain_string( const char* data, const std::size_t size, const std::string& source, const plain_mode mode = plain_mode::detect )
+   {
+      try {
+         return internal::plain_parse< Traits >( pegtl_input_t( data, size, source ) );
+      }
+      catch( const pegtl::parse_error& ) {
+         if( mode == plain_mode::require ) {
+            throw;
+         }
+      }
+      internal::config_parser c;
+      c.parse( data, size, source );
+      return c.finish< Traits >();
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits > basic_from_plain_string( const std::string_view data, const std::string& source, const plain_mode mode = plain_mode::detect )
+   {
+      return basic_from_plain_string< Traits >( data.data(), data.size(), source, mode );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits > basic_from_plain_file( const std::filesystem::path& path, const plain_mode mode = plain_mode::detect )
+   {
+      const std::string source = path.string();
+      const std::string data = internal::read_file_throws( source );
+      return basic_from_plain_string< Traits >( data, source, mode );
+   }
+
+   [[nodiscard]] inline value from_plain_string( const char* data, const std::size_t size, const std::string& source, const plain_mode mode = plain_mode::detect )
+   {
+      return basic_from_plain_string< traits >( data, size, source, mode );
+   }
+
+   [[nodiscard]] inline value from_plain_string( const std::string_view data, const std::string& source, const plain_mode mode = plain_mode::detect )
+   {
+      return from_plain_string( data.data(), data.size(), source, mode );
+   }
+
+   [[nodiscard]] inline value from_plain_file( const std::filesystem::path& path, const plain_mode mode = plain_mode::detect )
+   {
+      return basic_from_plain_file< traits >( path, mode );
+   }
+
+}  // namespace tao::config
+
+#endif
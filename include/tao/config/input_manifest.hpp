@@ -0,0 +1,145 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INPUT_MANIFEST_HPP
+#define TAO_CONFIG_INPUT_MANIFEST_HPP
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tao::config
+{
+   enum class input_kind : char
+   {
+      file = 0,
+      environment = 1
+   };
+
+   struct input_record
+   {
+      input_kind kind;
+      std::string name;
+      std::optional< std::uint64_t > hash;  // Empty for optional inputs that did not exist.
+   };
+
+   namespace internal
+   {
+      [[nodiscard]] constexpr std::uint64_t fnv1a( const std::string_view s ) noexcept
+      {
+         std::uint64_t h = 0xcbf29ce484222325ULL;
+         for( const char c : s ) {
+            h ^= static_cast< unsigned char >( c );
+            h *= 0x100000001b3ULL;
+         }
+         return h;
+      }
+
+      inline void depfile_escape( std::ostream& o, const std::string& s )
+      {
+         for( const char c : s ) {
+            switch( c ) {
+               case ' ':
+               case '#':
+               case '\\':
+                  o << '\\' << c;
+                  break;
+               case '$':
+                  o << "$$";
+                  break;
+               default:
+                  o << c;
+            }
+         }
+      }
+
+   }  // namespace internal
+
+   // Records the files and environment variables that a parser consulted, i.e. files that
+   // were parsed, included or read, and environment variables used by env and env?, each
+   // once, together with the 64-bit FNV-1a hash of its contents. Files that are parsed or
+   // included are recorded in the order in which the parser reaches them, the inputs of
+   // function calls follow in the unspecified order in which the functions are evaluated.
+
+   class input_manifest
+   {
+   public:
+      void add_file( const std::string& name, const std::string_view data )
+      {
+         add( input_kind::file, name, internal::fnv1a( data ) );
+      }
+
+      void add_missing_file( const std::string& name )
+      {
+         add( input_kind::file, name, std::nullopt );
+      }
+
+      void add_environment( const std::string& name, const std::optional< std::string_view > value )
+      {
+         add( input_kind::environment, name, value ? std::optional< std::uint64_t >( internal::fnv1a( *value ) ) : std::nullopt );
+      }
+
+      [[nodiscard]] const std::vector< input_record >& inputs() const noexcept
+      {
+         return m_inputs;
+      }
+
+      void clear() noexcept
+      {
+         m_inputs.clear();
+         m_seen.clear();
+      }
+
+      // Writes a make-style dependency rule for all files, e.g. for use as depfile in Make or Ninja.
+      // Missing optional files are included so that creating one triggers a rebuild; like with
+      // the -MP option of GCC they get an empty rule so that Make does not fail on them, which
+      // means that the target is considered out of date for as long as they are missing.
+
+      void to_depfile( std::ostream& o, const std::string& target ) const
+      {
+         internal::depfile_escape( o, target );
+         o << ':';
+         for( const auto& i : m_inputs ) {
+            if( i.kind == input_kind::file ) {
+               o << " \\\n  ";
+               internal::depfile_escape( o, i.name );
+            }
+         }
+         o << '\n';
+         for( const auto& i : m_inputs ) {
+            if( ( i.kind == input_kind::file ) && ( !i.hash ) ) {
+               o << '\n';
+               internal::depfile_escape( o, i.name );
+               o << ":\n";
+            }
+         }
+      }
+
+      [[nodiscard]] std::string to_depfile( const std::string& target ) const
+      {
+         std::ostringstream oss;
+         to_depfile( oss, target );
+         return std::move( oss ).str();
+      }
+
+   private:
+      void add( const input_kind kind, const std::string& name, const std::optional< std::uint64_t > hash )
+      {
+         if( m_seen.emplace( kind, name ).second ) {
+            m_inputs.push_back( input_record{ kind, name, hash } );
+         }
+      }
+
+      std::vector< input_record > m_inputs;
+      std::set< std::pair< input_kind, std::string > > m_seen;
+   };
+
+}  // namespace tao::config
+
+#endif
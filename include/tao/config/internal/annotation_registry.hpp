@@ -0,0 +1,163 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_ANNOTATION_REGISTRY_HPP
+#define TAO_CONFIG_INTERNAL_ANNOTATION_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "pegtl.hpp"
+
+#include "../annotation_table.hpp"
+#include "../key_chain.hpp"
+
+namespace tao::config::internal
+{
+   // Maps the 32-bit ids stored in sparse annotations to the annotation tables, so that a value
+   // can find its key and position without a pointer to the table. The ids are handed out in
+   // chunks, a table takes a new chunk for every chunk_size entries, and chunk numbers are only
+   // re-used after all others have been handed out. The top bit of an id marks the values that
+   // hold a reference to the table, i.e. the roots and their copies; the table is destroyed
+   // when the last of them is gone, ids of sub-values are then no longer found.
+
+   class annotation_registry
+   {
+   public:
+      static constexpr std::uint32_t owner_bit = std::uint32_t( 1 ) << 31;
+      static constexpr std::uint32_t chunk_bits = 10;
+      static constexpr std::uint32_t chunk_size = std::uint32_t( 1 ) << chunk_bits;
+      static constexpr std::uint32_t chunk_count = owner_bit >> chunk_bits;
+
+      [[nodiscard]] static annotation_registry& instance()
+      {
+         static annotation_registry* r = new annotation_registry();  // Never destroyed so that it outlives all static values.
+         return *r;
+      }
+
+      // Creates a new table with a single reference that must be released by the caller.
+
+      [[nodiscard]] const annotation_table* create()
+      {
+         auto t = std::make_unique< annotation_table >();
+         const annotation_table* p = t.get();
+         const std::lock_guard lock( m_mutex );
+         m_tables.try_emplace( p, std::move( t ) );
+         return p;
+      }
+
+      // Only the thread that created the table may add entries, and only until it is published.
+
+      [[nodiscard]] std::uint32_t add( const annotation_table* t, const key_chain& k, const pegtl::position& p )
+      {
+         const std::lock_guard lock( m_mutex );
+         record& r = m_tables.at( t );
+         const std::uint32_t i = r.table->add( k, p );
+         if( ( i % chunk_size ) == 0 ) {
+            r.chunks.emplace_back( acquire_chunk( t, std::uint32_t( r.chunks.size() ) ) );
+         }
+         return ( r.chunks.back() << chunk_bits ) | ( i % chunk_size );
+      }
+
+      void retain( const annotation_table* t )
+      {
+         const std::lock_guard lock( m_mutex );
+         ++m_tables.at( t ).references;
+      }
+
+      void retain( const std::uint32_t id )
+      {
+         const std::lock_guard lock( m_mutex );
+         if( const auto i = m_chunks.find( chunk( id ) ); i != m_chunks.end() ) {
+            ++m_tables.at( i->second.first ).references;
+         }
+      }
+
+      void release( const annotation_table* t ) noexcept
+      {
+         const std::lock_guard lock( m_mutex );
+         release_locked( t );
+      }
+
+      void release( const std::uint32_t id ) noexcept
+      {
+         const std::lock_guard lock( m_mutex );
+         if( const auto i = m_chunks.find( chunk( id ) ); i != m_chunks.end() ) {
+            release_locked( i->second.first );
+         }
+      }
+
+      // Calls f( table, index ) under the lock and returns true when the id is (still) valid.
+
+      template< typename F >
+      bool find( const std::uint32_t id, F&& f ) const
+      {
+         const std::lock_guard lock( m_mutex );
+         if( const auto i = m_chunks.find( chunk( id ) ); i != m_chunks.end() ) {
+            const annotation_table* t = i->second.first;
+            const std::size_t n = std::size_t( i->second.second ) * chunk_size + ( id % chunk_size );
+            if( n < t->size() ) {
+               f( *t, std::uint32_t( n ) );
+               return true;
+            }
+         }
+         return false;
+      }
+
+   private:
+      struct record
+      {
+         std::unique_ptr< annotation_table > table;
+         std::size_t references = 1;
+         std::vector< std::uint32_t > chunks;
+
+         explicit record( std::unique_ptr< annotation_table >&& t ) noexcept
+            : table( std::move( t ) )
+         {}
+      };
+
+      annotation_registry() = default;
+
+      [[nodiscard]] static std::uint32_t chunk( const std::uint32_t id ) noexcept
+      {
+         return ( id & ~owner_bit ) >> chunk_bits;
+      }
+
+      [[nodiscard]] std::uint32_t acquire_chunk( const annotation_table* t, const std::uint32_t n )
+      {
+         if( m_chunks.size() + 1 >= chunk_count ) {
+            throw std::length_error( "too many annotated values" );  // LCOV_EXCL_LINE
+         }
+         do {
+            m_next = ( m_next + 1 < chunk_count ) ? ( m_next + 1 ) : 1;  // Chunk 0 is never used so that id 0 means no annotation.
+         } while( m_chunks.count( m_next ) != 0 );
+         m_chunks.try_emplace( m_next, t, n );
+         return m_next;
+      }
+
+      void release_locked( const annotation_table* t ) noexcept
+      {
+         const auto i = m_tables.find( t );
+         if( ( i != m_tables.end() ) && ( --i->second.references == 0 ) ) {
+            for( const auto c : i->second.chunks ) {
+               m_chunks.erase( c );
+            }
+            m_tables.erase( i );
+         }
+      }
+
+      mutable std::mutex m_mutex;
+      std::uint32_t m_next = 0;
+      std::unordered_map< const annotation_table*, record > m_tables;
+      std::unordered_map< std::uint32_t, std::pair< const annotation_table*, std::uint32_t > > m_chunks;  // Table and chunk index within the table.
+   };
+
+}  // namespace tao::config::internal
+
+#endif
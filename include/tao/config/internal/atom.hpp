@@ -45,6 +45,29 @@ namespace tao::config::internal
       pegtl::position position;
    };
 
+   // String atoms also record whether the value is verbatim, i.e. the unchanged text between the two quotes
+   // of a string literal at the position, so that errors about individual characters can point at them.
+
+   template<>
+   struct atom< std::string >
+   {
+      template< typename V >
+      atom( V&& v, const pegtl::position& pos, const bool verb = false )
+         : value( std::forward< V >( v ) ),
+           position( pos ),
+           verbatim( verb )
+      {}
+
+      [[nodiscard]] const pegtl::position& get_position() const noexcept
+      {
+         return position;
+      }
+
+      std::string value;
+      pegtl::position position;
+      bool verbatim;
+   };
+
    using boolean = atom< bool >;
    using string_t = atom< std::string >;
    using binary_t = atom< std::vector< std::byte > >;
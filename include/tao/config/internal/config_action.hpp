@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cerrno>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -166,8 +167,24 @@ namespace tao::config::internal
       static void apply( const Input& ai, State& st, const function_map& fm )
       {
          try {
-            pegtl::file_input in( ai.string() );
-            pegtl::parse_nested< rules::config_file, config_action >( ai.position(), static_cast< pegtl_input_t& >( in ), st, fm );
+            if( st.cache ) {
+               if( st.prefetch ) {
+                  st.prefetch->wait( ai.string() );
+               }
+               const auto data = st.cache->get( ai.string() );
+               if( st.manifest ) {
+                  st.manifest->add_file( ai.string(), *data );
+               }
+               pegtl_input_t in( data->data(), data->size(), ai.string() );
+               pegtl::parse_nested< rules::config_file, config_action >( ai.position(), in, st, fm );
+            }
+            else {
+               pegtl::file_input in( ai.string() );
+               if( st.manifest ) {
+                  st.manifest->add_file( ai.string(), std::string_view( in.begin(), in.size() ) );
+               }
+               pegtl::parse_nested< rules::config_file, config_action >( ai.position(), static_cast< pegtl_input_t& >( in ), st, fm );
+            }
          }
          catch( const std::system_error& e ) {
             if( !st.include_is_optional ) {
@@ -176,6 +193,9 @@ namespace tao::config::internal
             if( e.code().value() != ENOENT ) {
                throw pegtl::parse_error( strcat( "include optional error: ", e.what() ), ai.position() );
             }
+            if( st.manifest ) {
+               st.manifest->add_missing_file( ai.string() );
+            }
          }
       }
    };
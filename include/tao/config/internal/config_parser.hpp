@@ -6,6 +6,9 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -27,17 +30,27 @@ namespace tao::config::internal
    struct config_parser
    {
       config_parser()
-         : fm( { { "binary", wrap( binary_function ) },
+         : fm( { { "base64", wrap( base64_function ) },
+                 { "binary", wrap( binary_function ) },
                  { "default", wrap( default_function ) },
-                 { "env", wrap( env_function ) },
-                 { "env?", wrap( env_if_function ) },
+                 { "env", wrap( std::function( [ this ]( const pegtl::position& p, const std::string& s ) { return recorded_env_function( p, s ); } ) ) },
+                 { "env?", wrap( std::function( [ this ]( const pegtl::position& p, const std::string& s, const std::string_view d ) { return recorded_env_if_function( p, s, d ); } ) ) },
+                 { "hex", wrap( hex_function ) },
                  { "jaxn", wrap( jaxn_function ) },
                  { "print", wrap( print_function ) },
-                 { "read", wrap( read_function ) },
-                 { "shell", wrap( shell_function ) },
+                 { "read", wrap( std::function( [ this ]( const pegtl::position& p, const std::string& s ) { return recorded_read_function( p, s ); } ) ) },
+                 { "shell", shell_function{ &st.shell } },
                  { "split", wrap( split_function ) },
                  { "string", wrap( string_function ) } } )
-      {}
+      {
+         // Functions whose results are worth re-using; base64, binary, hex and string are pure too but
+         // cheaper than building and looking up a memo key that contains their whole argument, default
+         // only selects one of its arguments, print is mostly used with arrays and objects for which no
+         // memo key is built, and shell is not pure.
+         for( const char* name : { "env", "env?", "jaxn", "parse", "read", "split" } ) {
+            st.memo.set_pure( name, true );
+         }
+      }
 
       config_parser( config_parser&& ) = delete;
       config_parser( const config_parser& ) = delete;
@@ -47,15 +60,33 @@ namespace tao::config::internal
 
       state st;
       function_map fm;
+      bool finished = false;
 
       void parse( pegtl_input_t&& in )
       {
+         if( st.prefetch ) {
+            st.prefetch->clear();
+            st.prefetch->scan( std::string_view( in.begin(), in.size() ) );
+         }
          pegtl::parse< rules::config_file, config_action >( in, st, fm );
       }
 
       void parse( const std::filesystem::path& path )
       {
-         parse( pegtl::file_input( path ) );
+         if( st.cache ) {
+            const auto data = st.cache->get( path );
+            if( st.manifest ) {
+               st.manifest->add_file( path.string(), *data );
+            }
+            parse( pegtl_input_t( data->data(), data->size(), path.string() ) );
+         }
+         else {
+            pegtl::file_input in( path );
+            if( st.manifest ) {
+               st.manifest->add_file( path.string(), std::string_view( in.begin(), in.size() ) );
+            }
+            parse( std::move( in ) );
+         }
       }
 
       void parse( const char* data, const std::size_t size, const std::string& source )
@@ -68,12 +99,57 @@ namespace tao::config::internal
          parse( data.data(), data.size(), source );
       }
 
+      // The functions that consult external inputs are wrapped to record them in the manifest, if any.
+
+      [[nodiscard]] const environment& snapshot_environment()
+      {
+         if( !st.env ) {
+            st.env = environment::snapshot();
+         }
+         return *st.env;
+      }
+
+      [[nodiscard]] string_t recorded_env_function( const pegtl::position& p, const std::string& s )
+      {
+         string_t r = env_function( p, snapshot_environment(), s );
+         if( st.manifest ) {
+            st.manifest->add_environment( s, r.value );
+         }
+         return r;
+      }
+
+      [[nodiscard]] string_t recorded_env_if_function( const pegtl::position& p, const std::string& s, const std::string_view d )
+      {
+         string_t r = env_if_function( p, snapshot_environment(), s, d );
+         if( st.manifest ) {
+            const std::string* v = st.env->find( s );
+            st.manifest->add_environment( s, v ? std::optional< std::string_view >( *v ) : std::nullopt );
+         }
+         return r;
+      }
+
+      [[nodiscard]] binary_t recorded_read_function( const pegtl::position& p, const std::string& s )
+      {
+         binary_t r = read_function( p, s );
+         if( st.manifest ) {
+            st.manifest->add_file( s, std::string_view( reinterpret_cast< const char* >( r.value.data() ), r.value.size() ) );
+         }
+         return r;
+      }
+
+      // The config is moved into the result, a parser can only be finished once.
+
       template< template< typename... > class Traits >
       [[nodiscard]] json::basic_value< Traits > finish()
       {
+         if( finished ) {
+            throw std::logic_error( "parser result can only be obtained once" );
+         }
+         finished = true;
          phase2_everything( st, fm );
+         st.memo.clear();
          phase3_remove( st.root );
-         return phase5_repack< Traits >( st.root );
+         return phase5_repack< Traits >( std::move( st.root ) );
       }
    };
 
@@ -21,6 +21,7 @@
 
 #include "../annotation.hpp"
 #include "../key.hpp"
+#include "../key_chain.hpp"
 
 namespace tao::config::internal
 {
@@ -80,6 +81,18 @@ namespace tao::config::internal
       TAO_JSON_DEFAULT_KEY( "key" );
    };
 
+   template<>
+   struct debug_traits< key_chain >
+   {
+      TAO_JSON_DEFAULT_KEY( "key" );
+
+      template< template< typename... > class Traits, typename Consumer >
+      static void produce( Consumer& c, const key_chain& k )
+      {
+         json::events::produce< Traits >( c, k.to_key() );
+      }
+   };
+
    template<>
    struct debug_traits< annotation >
       : json::binding::object< TAO_JSON_BIND_REQUIRED( "key", &annotation::key ),
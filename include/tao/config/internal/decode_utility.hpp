@@ -0,0 +1,208 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_DECODE_UTILITY_HPP
+#define TAO_CONFIG_INTERNAL_DECODE_UTILITY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace tao::config::internal
+{
+   // Values 0 to 63 are digits, all other values have bit 6 or 7 set so that the fast paths
+   // below can validate a whole group of characters with a single comparison.
+
+   inline constexpr std::uint8_t decode_blank = 64;
+   inline constexpr std::uint8_t decode_padding = 65;
+   inline constexpr std::uint8_t decode_invalid = 255;
+
+   [[nodiscard]] constexpr std::uint8_t decode_common( const char c ) noexcept
+   {
+      return ( ( c == ' ' ) || ( c == '\t' ) || ( c == '\r' ) || ( c == '\n' ) ) ? decode_blank : decode_invalid;
+   }
+
+   [[nodiscard]] constexpr std::uint8_t base64_digit( const char c ) noexcept
+   {
+      if( ( 'A' <= c ) && ( c <= 'Z' ) ) {
+         return std::uint8_t( c - 'A' );
+      }
+      if( ( 'a' <= c ) && ( c <= 'z' ) ) {
+         return std::uint8_t( c - 'a' + 26 );
+      }
+      if( ( '0' <= c ) && ( c <= '9' ) ) {
+         return std::uint8_t( c - '0' + 52 );
+      }
+      switch( c ) {
+         case '+':
+         case '-':
+            return 62;
+         case '/':
+         case '_':
+            return 63;
+         case '=':
+            return decode_padding;
+         default:
+            return decode_common( c );
+      }
+   }
+
+   [[nodiscard]] constexpr std::uint8_t hex_digit( const char c ) noexcept
+   {
+      if( ( '0' <= c ) && ( c <= '9' ) ) {
+         return std::uint8_t( c - '0' );
+      }
+      if( ( 'a' <= c ) && ( c <= 'f' ) ) {
+         return std::uint8_t( c - 'a' + 10 );
+      }
+      if( ( 'A' <= c ) && ( c <= 'F' ) ) {
+         return std::uint8_t( c - 'A' + 10 );
+      }
+      return decode_common( c );
+   }
+
+   template< std::uint8_t ( *F )( char ) noexcept >
+   [[nodiscard]] constexpr std::array< std::uint8_t, 256 > decode_make_table() noexcept
+   {
+      std::array< std::uint8_t, 256 > r = {};
+      for( std::size_t i = 0; i < r.size(); ++i ) {
+         r[ i ] = F( char( i ) );
+      }
+      return r;
+   }
+
+   inline constexpr std::array< std::uint8_t, 256 > base64_table = decode_make_table< base64_digit >();
+   inline constexpr std::array< std::uint8_t, 256 > hex_table = decode_make_table< hex_digit >();
+
+   // Both decoders append to the given vector and return std::string_view::npos on success; on error
+   // they leave the vector unchanged and return the offset of the first invalid character or, for
+   // incomplete input, the size of the input. Blanks are ignored anywhere, base64 accepts both the
+   // standard and the URL-safe alphabet, with or without padding.
+
+   [[nodiscard]] inline std::size_t base64_decode( const std::string_view s, std::vector< std::byte >& v )
+   {
+      const auto t = [ & ]( const std::size_t i ) { return base64_table[ static_cast< unsigned char >( s[ i ] ) ]; };
+
+      const std::size_t b = v.size();
+      v.resize( b + ( s.size() / 4 + 1 ) * 3 );
+      std::byte* o = v.data() + b;
+
+      std::uint32_t a = 0;
+      std::size_t n = 0;
+      std::size_t i = 0;
+      std::size_t p = 0;
+
+      while( i < s.size() ) {
+         if( n == 0 ) {
+            for( ; i + 4 <= s.size(); i += 4 ) {
+               const std::uint32_t c0 = t( i );
+               const std::uint32_t c1 = t( i + 1 );
+               const std::uint32_t c2 = t( i + 2 );
+               const std::uint32_t c3 = t( i + 3 );
+               if( ( c0 | c1 | c2 | c3 ) >= 64 ) {
+                  break;
+               }
+               const std::uint32_t x = ( c0 << 18 ) | ( c1 << 12 ) | ( c2 << 6 ) | c3;
+               *o++ = std::byte( x >> 16 );
+               *o++ = std::byte( x >> 8 );
+               *o++ = std::byte( x );
+            }
+            if( i == s.size() ) {
+               break;
+            }
+         }
+         switch( const std::uint8_t c = t( i ); c ) {
+            case decode_blank:
+               break;
+            case decode_padding:
+               if( ( n < 2 ) || ( n + ++p > 4 ) ) {
+                  v.resize( b );
+                  return i;
+               }
+               break;
+            case decode_invalid:
+               v.resize( b );
+               return i;
+            default:
+               if( p > 0 ) {
+                  v.resize( b );
+                  return i;
+               }
+               a = ( a << 6 ) | c;
+               if( ++n == 4 ) {
+                  *o++ = std::byte( a >> 16 );
+                  *o++ = std::byte( a >> 8 );
+                  *o++ = std::byte( a );
+                  a = 0;
+                  n = 0;
+               }
+         }
+         ++i;
+      }
+      if( ( n == 1 ) || ( ( p > 0 ) && ( n + p != 4 ) ) ) {
+         v.resize( b );
+         return s.size();
+      }
+      if( n == 2 ) {
+         *o++ = std::byte( a >> 4 );
+      }
+      else if( n == 3 ) {
+         *o++ = std::byte( a >> 10 );
+         *o++ = std::byte( a >> 2 );
+      }
+      v.resize( std::size_t( o - v.data() ) );
+      return std::string_view::npos;
+   }
+
+   [[nodiscard]] inline std::size_t hex_decode( const std::string_view s, std::vector< std::byte >& v )
+   {
+      const auto t = [ & ]( const std::size_t i ) { return hex_table[ static_cast< unsigned char >( s[ i ] ) ]; };
+
+      const std::size_t b = v.size();
+      v.resize( b + s.size() / 2 );
+      std::byte* o = v.data() + b;
+
+      std::uint8_t h = 0;
+      bool pending = false;  // Whether h is a high nibble still waiting for its low nibble.
+
+      for( std::size_t i = 0; i < s.size(); ++i ) {
+         if( !pending ) {
+            for( ; i + 2 <= s.size(); i += 2 ) {
+               const std::uint8_t c0 = t( i );
+               const std::uint8_t c1 = t( i + 1 );
+               if( ( c0 | c1 ) >= 64 ) {
+                  break;
+               }
+               *o++ = std::byte( ( c0 << 4 ) | c1 );
+            }
+            if( i == s.size() ) {
+               break;
+            }
+         }
+         switch( const std::uint8_t c = t( i ); c ) {
+            case decode_blank:
+               break;
+            case decode_invalid:
+               v.resize( b );
+               return i;
+            default:
+               if( pending ) {
+                  *o++ = std::byte( ( h << 4 ) | c );
+               }
+               h = c;
+               pending = !pending;
+         }
+      }
+      if( pending ) {
+         v.resize( b );
+         return s.size();
+      }
+      v.resize( std::size_t( o - v.data() ) );
+      return std::string_view::npos;
+   }
+
+}  // namespace tao::config::internal
+
+#endif
@@ -39,10 +39,25 @@ namespace tao::config::internal
          : m_data( s )
       {}
 
+      explicit entry( string_t&& s ) noexcept
+         : m_data( std::move( s ) )
+      {}
+
       explicit entry( const binary_t& b )
          : m_data( b )
       {}
 
+      explicit entry( binary_t&& b ) noexcept
+         : m_data( std::move( b ) )
+      {}
+
+      // Constructs the atom, array, object or concat directly in the entry, e.g. with the moved value of an atom.
+
+      template< typename T, typename... As >
+      explicit entry( const std::in_place_type_t< T > t, As&&... as )
+         : m_data( t, std::forward< As >( as )... )
+      {}
+
       explicit entry( const signed_t& s )
          : m_data( s )
       {}
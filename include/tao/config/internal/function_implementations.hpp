@@ -6,24 +6,73 @@
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "decode_utility.hpp"
 #include "entry.hpp"
 #include "forward.hpp"
+#include "function_traits.hpp"
 #include "jaxn_action.hpp"
 #include "jaxn_to_entry.hpp"
 #include "json.hpp"
 #include "pegtl.hpp"
 #include "phase5_repack.hpp"
+#include "shell_runner.hpp"
 #include "statistics.hpp"
+#include "string_utility.hpp"
 #include "system_utility.hpp"
 
+#include "../environment.hpp"
 #include "../key.hpp"
 
 namespace tao::config::internal
 {
-   [[nodiscard]] inline binary_t binary_function( const pegtl::position& p, const std::string& s )
+   // Decodes a string, or binary data, argument into binary data with the given decode function,
+   // see decode_utility.hpp. Errors are reported with the offset of the invalid character within
+   // the argument's value and, when the argument is a verbatim string literal, at the position of
+   // the character, otherwise at the position of the argument.
+
+   [[nodiscard]] inline bool decode_function( entry& e, const char* name, std::size_t ( *decode )( std::string_view, std::vector< std::byte >& ) )
+   {
+      array& a = e.get_array();
+      if( a.array.size() != 1 ) {
+         throw pegtl::parse_error( strcat( name, " function requires exactly one argument" ), a.position );
+      }
+      const argument_view args( a );
+      const entry& f = function_traits_entry( args, 0 );
+
+      std::string_view s;
+      if( f.is_string() ) {
+         s = f.get_string();
+      }
+      else if( f.is_binary() ) {
+         s = std::string_view( reinterpret_cast< const char* >( f.get_binary().data() ), f.get_binary().size() );
+      }
+      else {
+         throw pegtl::parse_error( strcat( "invalid type for ", name, " argument" ), f.get_position() );
+      }
+      binary_t r( std::vector< std::byte >(), a.position );
+
+      if( const std::size_t i = decode( s, r.value ); i != std::string_view::npos ) {
+         pegtl::position p = f.get_position();
+         if( f.is_string() && f.get_string_atom().verbatim ) {
+            p.byte += 1 + i;
+            p.column += 1 + i;
+         }
+         throw pegtl::parse_error( ( i == s.size() ) ? strcat( "incomplete ", name, " data" ) : strcat( "invalid character in ", name, " data at offset ", i ), p );
+      }
+      e.set_value( std::move( r ) );
+      return true;
+   }
+
+   [[nodiscard]] inline bool base64_function( entry& e )
+   {
+      return decode_function( e, "base64", base64_decode );
+   }
+
+   [[nodiscard]] inline binary_t binary_function( const pegtl::position& p, const std::string_view s )
    {
       const auto* const d = reinterpret_cast< const std::byte* >( s.data() );
       return binary_t( std::vector< std::byte >( d, d + s.size() ), p );
@@ -71,30 +120,36 @@ namespace tao::config::internal
       throw pegtl::parse_error( "default function requires at least one non-null argument", a.position );
    }
 
-   [[nodiscard]] inline string_t env_function( const pegtl::position& p, const std::string& s )
+   [[nodiscard]] inline string_t env_function( const pegtl::position& p, const environment& env, const std::string& s )
    {
-      return string_t( getenv_throws( p, s ), p );
+      if( const std::string* r = env.find( s ) ) {
+         return string_t( *r, p );
+      }
+      throw pegtl::parse_error( "environment variable '" + s + "' not found", p );
    }
 
-   [[nodiscard]] inline string_t env_if_function( const pegtl::position& p, const std::string& s, const std::string& d )
+   [[nodiscard]] inline string_t env_if_function( const pegtl::position& p, const environment& env, const std::string& s, const std::string_view d )
    {
-      const auto r = getenv_nothrow( s );
-      return string_t( r ? ( *r ) : d, p );
+      const std::string* r = env.find( s );
+      return string_t( r ? std::string( *r ) : std::string( d ), p );
    }
 
-   [[nodiscard]] inline entry jaxn_function( const pegtl::position& /*unused*/, const std::string& s )
+   [[nodiscard]] inline bool hex_function( entry& e )
+   {
+      return decode_function( e, "hex", hex_decode );
+   }
+
+   [[nodiscard]] inline entry jaxn_function( const pegtl::position& /*unused*/, const std::string_view s )
    {
       jaxn_to_entry consumer;
-      pegtl::memory_input in( s, "TODO" );
+      pegtl::memory_input in( s.data(), s.size(), "TODO" );
       pegtl::parse< json::jaxn::internal::grammar, jaxn_action, json::jaxn::internal::errors >( static_cast< pegtl_input_t& >( in ), consumer );
       return std::move( consumer.value ).value();
    }
 
    [[nodiscard]] inline binary_t read_function( const pegtl::position& p, const std::string& filename )
    {
-      const std::string d = read_file_throws( filename );
-      const std::byte* x = reinterpret_cast< const std::byte* >( d.data() );
-      return binary_t( std::vector< std::byte >( x, x + d.size() ), p );
+      return binary_t( read_file_binary_throws( filename ), p );
    }
 
    [[nodiscard]] inline bool print_function( entry& e )
@@ -114,15 +169,48 @@ namespace tao::config::internal
       return false;
    }
 
-   [[nodiscard]] inline string_t shell_function( const pegtl::position& p, [[maybe_unused]] const std::string& script )
+   // Moves the output of a successfully completed shell job into the entry of the call.
+
+   inline void shell_function_put( entry& e, shell_job& job, const shell_options& options )
    {
-#if defined( _MSC_VER )
-      throw pegtl::parse_error( "shell extension not supported on this platform", p );
-#else
-      return string_t( shell_popen_throws( p, script ), p );
-#endif
+      shell_job_check( job, options );
+
+      if( job.binary ) {
+         function_traits< binary_t >::put( e, binary_t( std::move( job.binary_output ), job.position ) );
+      }
+      else {
+         function_traits< string_t >::put( e, string_t( std::move( job.output ), job.position ) );
+      }
    }
 
+   // The shell function is a distinct function object type so that phase 2 can recognise
+   // it and run all ready calls concurrently before evaluating the remaining functions.
+
+   struct shell_function
+   {
+      const shell_options* options;
+
+      [[nodiscard]] bool operator()( entry& e ) const
+      {
+         array& a = e.get_array();
+         if( a.array.size() != 1 ) {
+            throw pegtl::parse_error( "shell function requires exactly one argument", a.position );
+         }
+         try {
+            shell_job job( function_traits< std::string >::get( argument_view( a ), 0 ), a.position, options->binary );
+#if !defined( _MSC_VER )
+            std::vector< shell_job* > jobs = { &job };
+            shell_run( jobs, *options );
+#endif
+            shell_function_put( e, job, *options );
+         }
+         catch( const arguments_unready& ) {
+            return false;
+         }
+         return true;
+      }
+   };
+
    // clang-format off
    struct split_star_ws : pegtl::star< pegtl::space > {};
    struct split_string : pegtl::plus< pegtl::invert< pegtl::space > > {};
@@ -145,15 +233,15 @@ namespace tao::config::internal
       }
    };
 
-   [[nodiscard]] inline entry split_function( const pegtl::position& p, const std::string& s )
+   [[nodiscard]] inline entry split_function( const pegtl::position& p, const std::string_view s )
    {
       entry result( array_init, p );
-      pegtl::memory_input< pegtl::tracking_mode::lazy, pegtl_input_t::eol_t, const char* > in( s, __FUNCTION__ );
+      pegtl::memory_input< pegtl::tracking_mode::lazy, pegtl_input_t::eol_t, const char* > in( s.data(), s.size(), __FUNCTION__ );
       pegtl::parse_nested< split_rule, split_action >( p, in, result, p );
       return result;
    }
 
-   [[nodiscard]] inline string_t string_function( const pegtl::position& p, const std::string& s )
+   [[nodiscard]] inline string_t string_function( const pegtl::position& p, const std::string_view s )
    {
       return string_t( s, p );
    }
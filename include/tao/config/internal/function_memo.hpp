@@ -0,0 +1,249 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_FUNCTION_MEMO_HPP
+#define TAO_CONFIG_INTERNAL_FUNCTION_MEMO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "array.hpp"
+#include "concat.hpp"
+#include "entry.hpp"
+#include "entry_kind.hpp"
+#include "pegtl.hpp"
+#include "reference2.hpp"
+#include "reference2_kind.hpp"
+#include "reference2_part.hpp"
+
+namespace tao::config::internal
+{
+   template< typename T >
+   void function_memo_append( std::string& k, const T& t )
+   {
+      char b[ sizeof( T ) ];
+      std::memcpy( b, &t, sizeof( T ) );
+      k.append( b, sizeof( T ) );
+   }
+
+   inline void function_memo_append( std::string& k, const char* p, const std::size_t n )
+   {
+      function_memo_append( k, std::uint64_t( n ) );
+      k.append( p, n );
+   }
+
+   // Returns the name of the called function followed by an unambiguous encoding of the
+   // argument values, or nothing when an argument is not a single primitive value.
+
+   [[nodiscard]] inline std::optional< std::string > function_memo_key( const array& a )
+   {
+      std::string k;
+      function_memo_append( k, a.function.data(), a.function.size() );
+
+      for( const concat& c : a.array ) {
+         if( c.concat.size() != 1 ) {
+            return std::nullopt;
+         }
+         const entry& e = c.concat.front();
+         k += char( e.kind() );
+
+         switch( e.kind() ) {
+            case entry_kind::NULL_:
+               continue;
+            case entry_kind::BOOLEAN:
+               k += char( e.get_boolean() );
+               continue;
+            case entry_kind::STRING:
+               function_memo_append( k, e.get_string().data(), e.get_string().size() );
+               continue;
+            case entry_kind::BINARY:
+               function_memo_append( k, reinterpret_cast< const char* >( e.get_binary().data() ), e.get_binary().size() );
+               continue;
+            case entry_kind::SIGNED:
+               function_memo_append( k, e.get_signed() );
+               continue;
+            case entry_kind::UNSIGNED:
+               function_memo_append( k, e.get_unsigned() );
+               continue;
+            case entry_kind::DOUBLE:
+               function_memo_append( k, e.get_double() );
+               continue;
+            case entry_kind::ARRAY:
+            case entry_kind::OBJECT:
+            case entry_kind::ASTERISK:
+            case entry_kind::REFERENCE:
+               return std::nullopt;
+         }
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+      return k;
+   }
+
+   [[nodiscard]] inline bool function_memo_same( const pegtl::position& l, const pegtl::position& r ) noexcept
+   {
+      return ( l.byte == r.byte ) && ( l.line == r.line ) && ( l.column == r.column ) && ( l.source == r.source );
+   }
+
+   inline void function_memo_position( pegtl::position& p, const pegtl::position& from, const pegtl::position& to )
+   {
+      if( function_memo_same( p, from ) ) {
+         p = to;
+      }
+   }
+
+   inline void function_memo_position( entry& e, const pegtl::position& from, const pegtl::position& to );
+
+   inline void function_memo_position( concat& c, const pegtl::position& from, const pegtl::position& to )
+   {
+      function_memo_position( c.position, from, to );
+      for( entry& e : c.concat ) {
+         function_memo_position( e, from, to );
+      }
+   }
+
+   inline void function_memo_position( std::vector< reference2_part >& v, const pegtl::position& from, const pegtl::position& to )
+   {
+      for( reference2_part& p : v ) {
+         function_memo_position( p.position, from, to );
+         if( p.kind() == reference2_kind::vector ) {
+            function_memo_position( p.get_vector(), from, to );
+         }
+      }
+   }
+
+   // Gives a re-used result the positions that a new evaluation at the position of the current call
+   // would give it: all positions, recursively, that are equal to the position of the original call
+   // are replaced with that of the current call; positions within the argument values, e.g. of the
+   // values parsed by parse or the strings returned by split, do not depend on the call and are kept.
+
+   inline void function_memo_position( entry& e, const pegtl::position& from, const pegtl::position& to )
+   {
+      switch( e.kind() ) {
+         case entry_kind::NULL_:
+            if( function_memo_same( e.get_position(), from ) ) {
+               e = entry( null( to ) );
+            }
+            return;
+         case entry_kind::BOOLEAN:
+            function_memo_position( e.get_boolean_atom().position, from, to );
+            return;
+         case entry_kind::STRING:
+            function_memo_position( e.get_string_atom().position, from, to );
+            return;
+         case entry_kind::BINARY:
+            function_memo_position( e.get_binary_atom().position, from, to );
+            return;
+         case entry_kind::SIGNED:
+            function_memo_position( e.get_signed_atom().position, from, to );
+            return;
+         case entry_kind::UNSIGNED:
+            function_memo_position( e.get_unsigned_atom().position, from, to );
+            return;
+         case entry_kind::DOUBLE:
+            function_memo_position( e.get_double_atom().position, from, to );
+            return;
+         case entry_kind::ARRAY:
+            function_memo_position( e.get_array().position, from, to );
+            for( concat& c : e.get_array().array ) {
+               function_memo_position( c, from, to );
+            }
+            return;
+         case entry_kind::OBJECT:
+            function_memo_position( e.get_object().position, from, to );
+            for( auto& p : e.get_object().object ) {
+               function_memo_position( p.second, from, to );
+            }
+            return;
+         case entry_kind::ASTERISK:
+            function_memo_position( e.get_asterisk(), from, to );
+            return;
+         case entry_kind::REFERENCE:
+            function_memo_position( e.get_reference().vector(), from, to );
+            return;
+      }
+      throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+   }
+
+   struct function_memo_result
+   {
+      pegtl::position position;  // Of the call that computed the value.
+      entry value;
+   };
+
+   // Remembers the results of calls to pure functions, i.e. functions whose result only depends
+   // on the values of their arguments, so that repeated calls with the same arguments anywhere in
+   // the config are evaluated only once. Calls with arguments that are not primitive values are
+   // always evaluated, and large strings and binary data, e.g. from read, are not remembered in
+   // order to not double the peak memory usage for configs that embed large files.
+
+   class function_memo
+   {
+   public:
+      static constexpr std::size_t max_result_size = 1 << 20;
+
+      [[nodiscard]] bool is_pure( const std::string& name ) const noexcept
+      {
+         return m_pure.count( name ) != 0;
+      }
+
+      void set_pure( const std::string& name, const bool pure )
+      {
+         if( pure ) {
+            m_pure.emplace( name );
+         }
+         else {
+            m_pure.erase( name );
+         }
+      }
+
+      [[nodiscard]] const function_memo_result* find( const std::string& key )
+      {
+         if( const auto i = m_results.find( key ); i != m_results.end() ) {
+            ++m_hits;
+            return &i->second;
+         }
+         return nullptr;
+      }
+
+      void insert( std::string&& key, const pegtl::position& position, const entry& result )
+      {
+         ++m_misses;
+         if( ( result.is_string() && ( result.get_string().size() > max_result_size ) ) || ( result.is_binary() && ( result.get_binary().size() > max_result_size ) ) ) {
+            return;
+         }
+         m_results.emplace( std::move( key ), function_memo_result{ position, result } );
+      }
+
+      void clear() noexcept
+      {
+         m_results.clear();
+      }
+
+      [[nodiscard]] std::uint64_t hits() const noexcept
+      {
+         return m_hits;
+      }
+
+      [[nodiscard]] std::uint64_t misses() const noexcept
+      {
+         return m_misses;
+      }
+
+   private:
+      std::set< std::string > m_pure;
+      std::map< std::string, function_memo_result > m_results;
+      std::uint64_t m_hits = 0;
+      std::uint64_t m_misses = 0;
+   };
+
+}  // namespace tao::config::internal
+
+#endif
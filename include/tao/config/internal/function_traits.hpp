@@ -4,15 +4,21 @@
 #ifndef TAO_CONFIG_INTERNAL_FUNCTION_TRAITS_HPP
 #define TAO_CONFIG_INTERNAL_FUNCTION_TRAITS_HPP
 
+#include <array>
 #include <cassert>
 #include <cstddef>
-#include <iterator>
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "array.hpp"
+#include "concat.hpp"
 #include "entry.hpp"
+#include "entry_kind.hpp"
 #include "forward.hpp"
 #include "json.hpp"
 #include "key1.hpp"
@@ -27,53 +33,137 @@ namespace tao::config::internal
    template< typename, typename = void >
    struct function_traits;
 
-   template<>
-   struct function_traits< entry >
+   template< typename T >
+   struct function_traits< atom< T > >
    {
-      static void put( entry& e, entry&& f )
+      static void put( entry& e, atom< T >&& v )
       {
-         e = std::move( f );
+         e.set_value( std::move( v ) );
       }
 
-      static void put( entry& e, const entry& f )
+      static void put( entry& e, const atom< T >& v )
       {
-         e = f;
+         e.set_value( v );
       }
    };
 
-   template< typename T >
-   struct function_traits< atom< T > >
+   // Indexes the arguments of a function call once so that each argument can be accessed
+   // in constant time instead of walking the std::list of arguments for every argument.
+
+   class argument_view
    {
-      static void put( entry& e, atom< T >&& v )
+   public:
+      explicit argument_view( const array& f )
+         : m_size( f.array.size() ),
+           m_data( m_small.data() )
       {
-         e.set_value( std::move( v ) );
+         if( m_size > m_small.size() ) {
+            m_large.resize( m_size );
+            m_data = m_large.data();
+         }
+         const concat** p = m_data;
+         for( const concat& c : f.array ) {
+            *p++ = &c;
+         }
       }
 
-      static void put( entry& e, const atom< T >& v )
+      argument_view( argument_view&& ) = delete;
+      argument_view( const argument_view& ) = delete;
+
+      ~argument_view() = default;
+
+      void operator=( argument_view&& ) = delete;
+      void operator=( const argument_view& ) = delete;
+
+      [[nodiscard]] std::size_t size() const noexcept
       {
-         e.set_value( v );
+         return m_size;
       }
+
+      [[nodiscard]] const concat& operator[]( const std::size_t i ) const noexcept
+      {
+         assert( i < m_size );
+         return *m_data[ i ];
+      }
+
+   private:
+      std::size_t m_size;
+      const concat** m_data;
+      std::array< const concat*, 8 > m_small;
+      std::vector< const concat* > m_large;
    };
 
-   [[nodiscard]] inline const entry& function_traits_entry( array& f, const std::size_t i )
+   [[nodiscard]] inline const entry& function_traits_entry( const argument_view& f, const std::size_t i )
    {
-      assert( f.array.size() > i );
+      const concat& c = f[ i ];
 
-      auto p = f.array.begin();
-      std::advance( p, i );
+      assert( !c.concat.empty() );
 
-      assert( !p->concat.empty() );
+      if( c.concat.size() != 1 ) {
+         throw arguments_unready();
+      }
+      const entry& e = c.concat.front();
 
-      if( p->concat.size() != 1 ) {
+      if( e.is_reference() || e.is_asterisk() || ( e.is_array() && !e.get_array().function.empty() ) ) {
          throw arguments_unready();
       }
-      return p->concat.front();
+      return e;
+   }
+
+   [[nodiscard]] inline std::string_view function_traits_binary_as_string( const entry& e )
+   {
+      const std::vector< std::byte >& b = e.get_binary();
+      const std::string_view s( reinterpret_cast< const char* >( b.data() ), b.size() );
+
+      if( !json::internal::validate_utf8_nothrow( s ) ) {
+         throw pegtl::parse_error( "invalid utf-8 in binary data used as string", e.get_position() );
+      }
+      return s;
    }
 
+   // The get() functions for std::string_view, tao::binary_view and entry borrow from the
+   // arguments of the function call, which remain valid until the function has returned.
+
+   template<>
+   struct function_traits< entry >
+   {
+      [[nodiscard]] static const entry& get( const argument_view& f, const std::size_t i )
+      {
+         return function_traits_entry( f, i );
+      }
+
+      static void put( entry& e, entry&& f )
+      {
+         e = std::move( f );
+      }
+
+      static void put( entry& e, const entry& f )
+      {
+         e = f;
+      }
+   };
+
    template<>
    struct function_traits< std::string >
    {
-      [[nodiscard]] static std::string get( array& f, const std::size_t i )
+      [[nodiscard]] static std::string get( const argument_view& f, const std::size_t i )
+      {
+         const entry& e = function_traits_entry( f, i );
+
+         if( e.is_string() ) {
+            return e.get_string();
+         }
+         if( e.is_binary() ) {
+            return std::string( function_traits_binary_as_string( e ) );
+         }
+         throw pegtl::parse_error( "invalid type for string argument", e.get_position() );
+      }
+   };
+
+   template<>
+   struct function_traits< std::string_view >
+   {
+      [[nodiscard]] static std::string_view get( const argument_view& f, const std::size_t i )
       {
          const entry& e = function_traits_entry( f, i );
 
@@ -81,17 +171,98 @@ namespace tao::config::internal
             return e.get_string();
          }
          if( e.is_binary() ) {
-            const std::vector< std::byte >& b = e.get_binary();
-            const std::string s( reinterpret_cast< const char* >( b.data() ), b.size() );
-            if( !json::internal::validate_utf8_nothrow( s ) ) {
-               throw pegtl::parse_error( "invalid utf-8 in binary data used as string", e.get_position() );
-            }
-            return s;
+            return function_traits_binary_as_string( e );
          }
          throw pegtl::parse_error( "invalid type for string argument", e.get_position() );
       }
    };
 
+   template<>
+   struct function_traits< tao::binary_view >
+   {
+      [[nodiscard]] static tao::binary_view get( const argument_view& f, const std::size_t i )
+      {
+         const entry& e = function_traits_entry( f, i );
+
+         if( e.is_binary() ) {
+            return tao::binary_view( e.get_binary().data(), e.get_binary().size() );
+         }
+         if( e.is_string() ) {
+            return tao::binary_view( reinterpret_cast< const std::byte* >( e.get_string().data() ), e.get_string().size() );
+         }
+         throw pegtl::parse_error( "invalid type for binary argument", e.get_position() );
+      }
+   };
+
+   template<>
+   struct function_traits< bool >
+   {
+      [[nodiscard]] static bool get( const argument_view& f, const std::size_t i )
+      {
+         const entry& e = function_traits_entry( f, i );
+
+         if( e.kind() == entry_kind::BOOLEAN ) {
+            return e.get_boolean();
+         }
+         throw pegtl::parse_error( "invalid type for boolean argument", e.get_position() );
+      }
+   };
+
+   template< typename T >
+   struct function_traits< T, std::enable_if_t< std::is_integral_v< T > && !std::is_same_v< T, bool > > >
+   {
+      [[nodiscard]] static constexpr bool is_negative_in_range( const std::int64_t v ) noexcept
+      {
+         return std::is_signed_v< T > && ( v >= std::int64_t( ( std::numeric_limits< T >::min )() ) );
+      }
+
+      [[nodiscard]] static constexpr bool is_in_range( const std::uint64_t v ) noexcept
+      {
+         return v <= std::uint64_t( ( std::numeric_limits< T >::max )() );
+      }
+
+      [[nodiscard]] static T get( const argument_view& f, const std::size_t i )
+      {
+         const entry& e = function_traits_entry( f, i );
+
+         switch( e.kind() ) {
+            case entry_kind::SIGNED:
+               if( const std::int64_t v = e.get_signed(); ( v < 0 ) ? is_negative_in_range( v ) : is_in_range( std::uint64_t( v ) ) ) {
+                  return T( v );
+               }
+               break;
+            case entry_kind::UNSIGNED:
+               if( const std::uint64_t v = e.get_unsigned(); is_in_range( v ) ) {
+                  return T( v );
+               }
+               break;
+            default:
+               throw pegtl::parse_error( "invalid type for integer argument", e.get_position() );
+         }
+         throw pegtl::parse_error( "integer argument out of range", e.get_position() );
+      }
+   };
+
+   template<>
+   struct function_traits< double >
+   {
+      [[nodiscard]] static double get( const argument_view& f, const std::size_t i )
+      {
+         const entry& e = function_traits_entry( f, i );
+
+         switch( e.kind() ) {
+            case entry_kind::SIGNED:
+               return double( e.get_signed() );
+            case entry_kind::UNSIGNED:
+               return double( e.get_unsigned() );
+            case entry_kind::DOUBLE:
+               return e.get_double();
+            default:
+               throw pegtl::parse_error( "invalid type for double argument", e.get_position() );
+         }
+      }
+   };
+
 }  // namespace tao::config::internal
 
 #endif
@@ -5,6 +5,7 @@
 #define TAO_CONFIG_INTERNAL_FUNCTION_WRAPPER_HPP
 
 #include <cstddef>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -12,6 +13,7 @@
 #include "function_traits.hpp"
 #include "json.hpp"
 #include "pegtl.hpp"
+#include "string_utility.hpp"
 
 namespace tao::config::internal
 {
@@ -27,42 +29,49 @@ namespace tao::config::internal
       } );
    }
 
-   template< typename R, typename A >
-   [[nodiscard]] function wrap( R ( *x )( const pegtl::position&, A ) )
+   // Functions can take any number of arguments of all types for which function_traits<>::get()
+   // is defined, e.g. std::string_view, tao::binary_view or const entry& to borrow the argument
+   // without copying, integers, double and bool, and return all types with function_traits<>::put().
+
+   template< typename R, typename... As >
+   struct function_wrapper
    {
       static_assert( !std::is_pointer_v< R > );
       static_assert( !std::is_reference_v< R > );
       static_assert( !std::is_same_v< R, void > );
 
-      return function( [ x ]( entry& e ) {
-         try {
-            array& f = e.get_array();
-            function_traits< std::decay_t< R > >::put( e, x( f.position, function_traits< std::decay_t< A > >::get( f, 0 ) ) );
-         }
-         catch( const arguments_unready& ) {
-            return false;
-         }
-         return true;
-      } );
-   }
+      template< typename F, std::size_t... Is >
+      [[nodiscard]] static function wrap( F&& x, std::index_sequence< Is... > /*unused*/ )
+      {
+         return function( [ x = std::forward< F >( x ) ]( entry& e ) {
+            try {
+               array& f = e.get_array();
+               if( f.array.size() != sizeof...( As ) ) {
+                  throw pegtl::parse_error( strcat( f.function, " function requires exactly ", sizeof...( As ), ( sizeof...( As ) == 1 ) ? " argument" : " arguments" ), f.position );
+               }
+               const argument_view args( f );
+               function_traits< std::decay_t< R > >::put( e, x( f.position, function_traits< std::decay_t< As > >::get( args, Is )... ) );
+            }
+            catch( const arguments_unready& ) {
+               return false;
+            }
+            return true;
+         } );
+      }
+   };
 
-   template< typename R, typename A, typename B >
-   [[nodiscard]] function wrap( R ( *x )( const pegtl::position&, A, B ) )
+   template< typename R, typename... As >
+   [[nodiscard]] function wrap( R ( *x )( const pegtl::position&, As... ) )
    {
-      static_assert( !std::is_pointer_v< R > );
-      static_assert( !std::is_reference_v< R > );
-      static_assert( !std::is_same_v< R, void > );
+      return function_wrapper< R, As... >::wrap( x, std::index_sequence_for< As... >() );
+   }
 
-      return function( [ x ]( entry& e ) {
-         try {
-            array& f = e.get_array();
-            function_traits< std::decay_t< R > >::put( e, x( f.position, function_traits< std::decay_t< A > >::get( f, 0 ), function_traits< std::decay_t< B > >::get( f, 1 ) ) );
-         }
-         catch( const arguments_unready& ) {
-            return false;
-         }
-         return true;
-      } );
+   // For function objects like lambdas that capture state, use as wrap( std::function( ... ) ).
+
+   template< typename R, typename... As >
+   [[nodiscard]] function wrap( std::function< R( const pegtl::position&, As... ) >&& x )
+   {
+      return function_wrapper< R, As... >::wrap( std::move( x ), std::index_sequence_for< As... >() );
    }
 
 }  // namespace tao::config::internal
@@ -0,0 +1,227 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_INCLUDE_PREFETCH_HPP
+#define TAO_CONFIG_INTERNAL_INCLUDE_PREFETCH_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../file_cache.hpp"
+
+namespace tao::config::internal
+{
+   [[nodiscard]] constexpr bool is_prefetch_blank( const char c ) noexcept
+   {
+      return ( c == ' ' ) || ( c == '\t' ) || ( c == '\r' ) || ( c == '\n' );
+   }
+
+   // Finds the file names of all '(include "...")' and '(include? "...")' extensions without
+   // running the grammar; matches in comments or strings only lead to superfluous prefetches.
+
+   [[nodiscard]] inline std::vector< std::string > scan_includes( const std::string_view s )
+   {
+      std::vector< std::string > result;
+
+      for( std::size_t i = s.find( "include" ); i != std::string_view::npos; i = s.find( "include", i + 7 ) ) {
+         std::size_t b = i;
+         while( ( b > 0 ) && is_prefetch_blank( s[ b - 1 ] ) ) {
+            --b;
+         }
+         if( ( b == 0 ) || ( s[ b - 1 ] != '(' ) ) {
+            continue;
+         }
+         std::size_t j = i + 7;
+         if( ( j < s.size() ) && ( s[ j ] == '?' ) ) {
+            ++j;
+         }
+         const std::size_t k = j;
+         while( ( j < s.size() ) && is_prefetch_blank( s[ j ] ) ) {
+            ++j;
+         }
+         if( ( j == k ) || ( j == s.size() ) || ( s[ j ] != '"' ) ) {
+            continue;
+         }
+         const std::size_t e = s.find( '"', ++j );
+         if( ( e == std::string_view::npos ) || ( e == j ) ) {
+            continue;
+         }
+         result.emplace_back( s.substr( j, e - j ) );
+      }
+      return result;
+   }
+
+   // Reads all files included by a config, recursively, into the file cache with a small pool
+   // of worker threads so that the latencies of the reads overlap while the number of threads stays
+   // bounded. The parser waits for a file that is being read before it gets it from the cache, and
+   // takes files that no worker has started yet off the queue to read them itself. Errors are
+   // ignored here, they are reported when the parser itself reaches the include.
+
+   class include_prefetch
+   {
+   public:
+      static constexpr std::size_t default_threads = 8;
+
+      explicit include_prefetch( std::shared_ptr< file_cache > cache, const std::size_t threads = default_threads ) noexcept
+         : m_cache( std::move( cache ) ),
+           m_limit( ( std::max )( threads, std::size_t( 1 ) ) )
+      {}
+
+      include_prefetch( include_prefetch&& ) = delete;
+      include_prefetch( const include_prefetch& ) = delete;
+
+      ~include_prefetch()
+      {
+         {
+            const std::lock_guard< std::mutex > lock( m_mutex );
+            m_stop = true;
+         }
+         m_work.notify_all();
+
+         for( auto& t : m_threads ) {
+            t.join();
+         }
+      }
+
+      void operator=( include_prefetch&& ) = delete;
+      void operator=( const include_prefetch& ) = delete;
+
+      [[nodiscard]] std::size_t threads() const noexcept
+      {
+         return m_limit;
+      }
+
+      // Forgets the files of previous configs, except those still being read, so that the status
+      // only grows with the includes of the current config when a parser is used many times.
+
+      void clear()
+      {
+         const std::lock_guard< std::mutex > lock( m_mutex );
+         m_queue.clear();
+         for( auto i = m_status.begin(); i != m_status.end(); ) {
+            i = ( i->second == status::running ) ? std::next( i ) : m_status.erase( i );
+         }
+      }
+
+      void scan( const std::string_view data )
+      {
+         for( auto& name : scan_includes( data ) ) {
+            start( std::move( name ) );
+         }
+      }
+
+      void wait( const std::string& name )
+      {
+         std::unique_lock< std::mutex > lock( m_mutex );
+
+         const auto i = m_status.find( name );
+         if( i == m_status.end() ) {
+            return;
+         }
+         if( i->second == status::queued ) {
+            m_queue.erase( std::find( m_queue.begin(), m_queue.end(), name ) );
+            i->second = status::done;
+            return;
+         }
+         m_done.wait( lock, [ & ]() { return i->second == status::done; } );
+      }
+
+      // Waits until no file is queued or being read, e.g. for tests.
+
+      void wait_all()
+      {
+         std::unique_lock< std::mutex > lock( m_mutex );
+         m_done.wait( lock, [ this ]() { return m_queue.empty() && ( m_running == 0 ); } );
+      }
+
+   private:
+      enum class status : char
+      {
+         queued,
+         running,
+         done
+      };
+
+      void start( std::string name )
+      {
+         {
+            const std::lock_guard< std::mutex > lock( m_mutex );
+            if( m_stop || ( !m_status.emplace( name, status::queued ).second ) ) {
+               return;
+            }
+            m_queue.emplace_back( std::move( name ) );
+
+            if( ( m_threads.size() < m_limit ) && ( m_threads.size() < m_queue.size() + m_running ) ) {
+               try {
+                  m_threads.emplace_back( [ this ]() { work(); } );
+               }
+               catch( const std::system_error& /*unused*/ ) {
+                  // No more threads, the existing workers or the parser will read the file.
+               }
+            }
+            if( m_threads.empty() ) {
+               m_status[ m_queue.back() ] = status::done;
+               m_queue.pop_back();
+               return;
+            }
+         }
+         m_work.notify_one();
+      }
+
+      void work()
+      {
+         std::unique_lock< std::mutex > lock( m_mutex );
+
+         while( true ) {
+            m_work.wait( lock, [ this ]() { return m_stop || ( !m_queue.empty() ); } );
+            if( m_stop ) {
+               return;
+            }
+            const std::string name = std::move( m_queue.front() );
+            m_queue.pop_front();
+            m_status[ name ] = status::running;
+            ++m_running;
+            lock.unlock();
+
+            try {
+               scan( *m_cache->get( name ) );
+            }
+            catch( const std::exception& /*unused*/ ) {
+            }
+            lock.lock();
+            m_status[ name ] = status::done;
+            --m_running;
+            m_done.notify_all();
+         }
+      }
+
+      std::shared_ptr< file_cache > m_cache;
+      const std::size_t m_limit;
+
+      std::mutex m_mutex;
+      std::condition_variable m_work;
+      std::condition_variable m_done;
+      std::deque< std::string > m_queue;
+      std::map< std::string, status > m_status;
+      std::size_t m_running = 0;
+      bool m_stop = false;
+
+      std::vector< std::thread > m_threads;
+   };
+
+}  // namespace tao::config::internal
+
+#endif
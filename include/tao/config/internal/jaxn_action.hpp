@@ -5,9 +5,13 @@
 #define TAO_CONFIG_INTERNAL_JAXN_ACTION_HPP
 
 #include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -17,6 +21,73 @@
 
 namespace tao::config::internal
 {
+   // Converts 8 decimal digits at once with the usual SWAR multiply-and-shift sequence;
+   // the 8 bytes are loaded in little-endian order, other platforms use the plain loop.
+
+   [[nodiscard]] inline std::uint64_t decimal8_to_integer( const char* p ) noexcept
+   {
+      std::uint64_t v;
+      std::memcpy( &v, p, 8 );
+      v -= 0x3030303030303030ULL;
+      v = ( v * 10 ) + ( v >> 8 );
+      return ( ( ( v & 0x000000FF000000FFULL ) * ( 100 + ( 1000000ULL << 32 ) ) ) + ( ( ( v >> 16 ) & 0x000000FF000000FFULL ) * ( 1 + ( 10000ULL << 32 ) ) ) ) >> 32;
+   }
+
+   // Requires n <= 19 so that the result can not overflow.
+
+   [[nodiscard]] inline std::uint64_t decimal_to_integer( const char* p, std::size_t n ) noexcept
+   {
+      std::uint64_t r = 0;
+#if( defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) ) || defined( _MSC_VER )
+      for( ; n >= 8; n -= 8, p += 8 ) {
+         r = ( r * 100000000 ) + decimal8_to_integer( p );
+      }
+#endif
+      for( ; n > 0; --n, ++p ) {
+         r = ( r * 10 ) + std::uint64_t( *p - '0' );
+      }
+      return r;
+   }
+
+   // Integers with at most 19 digits and, when std::from_chars() supports doubles, all
+   // floating-point numbers written with a decimal point and/or exponent are converted
+   // directly; everything else is left to json::internal::number_state::success(). The
+   // string s is the matched number without the leading minus sign, if any.
+
+   template< bool NEG, typename Consumer >
+   [[nodiscard]] bool number_fast_path( const std::string_view s, const json::internal::number_state< NEG >& state, Consumer& consumer, const pegtl::position& pos )
+   {
+      if( ( !state.isfp ) && ( !state.drop ) && ( state.exponent10 == 0 ) && ( state.msize > 0 ) && ( state.msize <= 19 ) ) {
+         const std::uint64_t value = decimal_to_integer( state.mantissa, state.msize );
+         if constexpr( NEG ) {
+            if( value < 9223372036854775808ULL ) {
+               consumer.number( -static_cast< std::int64_t >( value ), pos );
+               return true;
+            }
+            if( value == 9223372036854775808ULL ) {
+               consumer.number( static_cast< std::int64_t >( -9223372036854775807LL - 1 ), pos );
+               return true;
+            }
+            return false;
+         }
+         else {
+            consumer.number( value, pos );
+            return true;
+         }
+      }
+#if defined( __cpp_lib_to_chars )
+      if( state.isfp && ( !s.empty() ) && ( s[ 0 ] != '-' ) && ( s[ 0 ] != '+' ) ) {
+         double value;
+         const auto [ ptr, ec ] = std::from_chars( s.data(), s.data() + s.size(), value );
+         if( ( ec == std::errc() ) && ( ptr == s.data() + s.size() ) ) {
+            consumer.number( NEG ? -value : value, pos );
+            return true;
+         }
+      }
+#endif
+      return false;
+   }
+
    template< typename Rule >
    struct jaxn_action
       : pegtl::nothing< Rule >
@@ -68,13 +139,16 @@ namespace tao::config::internal
       template< typename Input, typename Consumer >
       static void apply( const Input& in, Consumer& consumer )
       {
+         const char* b = in.begin();
+         while( ( b < in.end() ) && ( *b == '0' ) ) {
+            ++b;
+         }
+         if( in.end() - b > 16 ) {
+            throw pegtl::parse_error( "JAXN hexadecimal number too large", in );
+         }
          std::uint64_t value = 0;
-         for( char c : in ) {
-            if( value & 0xF000000000000000 ) {
-               throw pegtl::parse_error( "JAXN hexadecimal number too large", in );
-            }
-            value <<= 4;
-            value += json::internal::hex_char_to_integer< std::uint8_t >( c );
+         for( ; b < in.end(); ++b ) {
+            value = ( value << 4 ) + json::internal::hex_char_to_integer< std::uint8_t >( *b );
          }
          if constexpr( NEG ) {
             if( value < 9223372036854775808ULL ) {
@@ -303,38 +377,82 @@ namespace tao::config::internal
       }
    };
 
+   // Like pegtl::change_states< json::internal::number_state< NEG > > but also remembers where
+   // the number starts so that the fast path can convert exactly the matched characters.
+
    template< bool NEG >
    struct jaxn_action< json::jaxn::internal::rules::number< NEG > >
-      : pegtl::change_states< json::internal::number_state< NEG > >
+      : pegtl::maybe_nothing
    {
-      template< typename Input, typename Consumer >
-      static void success( const Input& in, json::internal::number_state< NEG >& state, Consumer& consumer )
+      template< typename Rule,
+                pegtl::apply_mode A,
+                pegtl::rewind_mode M,
+                template< typename... >
+                class Action,
+                template< typename... >
+                class Control,
+                typename ParseInput,
+                typename Consumer >
+      [[nodiscard]] static bool match( ParseInput& in, Consumer& consumer )
       {
-         state.success( consumer, in.position() );
+         const char* begin = in.current();
+         json::internal::number_state< NEG > state;
+
+         if( pegtl::match< Rule, A, M, Action, Control >( in, state ) ) {
+            if constexpr( A == pegtl::apply_mode::action ) {
+               if( !number_fast_path( std::string_view( begin, std::size_t( in.current() - begin ) ), state, consumer, in.position() ) ) {
+                  state.success( consumer, in.position() );
+               }
+            }
+            return true;
+         }
+         return false;
       }
    };
 
-   template<>
-   struct jaxn_action< json::jaxn::internal::rules::single_string >
-      : change_action_and_states< json::jaxn::internal::unescape_action, std::string >
+   // Like change_action_and_states< json::jaxn::internal::unescape_action, std::string > but also tells the
+   // consumer whether the string is verbatim, which is the case when the matched input is exactly two bytes
+   // longer than the string: escape sequences are longer than the characters they stand for, and all other
+   // kinds of string literals, and concatenations of string literals, have more than two delimiters.
+
+   struct jaxn_string_action
+      : pegtl::maybe_nothing
    {
-      template< typename Consumer >
-      static void success( const pegtl::position& pos, std::string& unescaped, Consumer& consumer )
+      template< typename Rule,
+                pegtl::apply_mode A,
+                pegtl::rewind_mode M,
+                template< typename... >
+                class Action,
+                template< typename... >
+                class Control,
+                typename ParseInput,
+                typename Consumer >
+      [[nodiscard]] static bool match( ParseInput& in, Consumer& consumer )
       {
-         consumer.string( std::move( unescaped ), pos );
+         const char* begin = in.current();
+         const auto pos = in.position();
+         std::string unescaped;
+
+         if( Control< Rule >::template match< A, M, json::jaxn::internal::unescape_action, Control >( in, unescaped ) ) {
+            if constexpr( A == pegtl::apply_mode::action ) {
+               const bool verbatim = ( std::size_t( in.current() - begin ) == unescaped.size() + 2 );
+               consumer.string( std::move( unescaped ), pos, verbatim );
+            }
+            return true;
+         }
+         return false;
       }
    };
 
+   template<>
+   struct jaxn_action< json::jaxn::internal::rules::single_string >
+      : jaxn_string_action
+   {};
+
    template<>
    struct jaxn_action< json::jaxn::internal::rules::string >
-      : change_action_and_states< json::jaxn::internal::unescape_action, std::string >
-   {
-      template< typename Consumer >
-      static void success( const pegtl::position& pos, std::string& unescaped, Consumer& consumer )
-      {
-         consumer.string( std::move( unescaped ), pos );
-      }
-   };
+      : jaxn_string_action
+   {};
 
    template<>
    struct jaxn_action< json::jaxn::internal::rules::key >
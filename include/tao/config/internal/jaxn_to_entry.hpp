@@ -65,19 +65,19 @@ namespace tao::config::internal
          value.emplace( internal::string_t( v, p ) );
       }
 
-      void string( std::string&& v, const pegtl::position& p )
+      void string( std::string&& v, const pegtl::position& p, const bool verbatim = false )
       {
-         value.emplace( internal::string_t( std::move( v ), p ) );
+         value.emplace( std::in_place_type< internal::string_t >, std::move( v ), p, verbatim );
       }
 
       void binary( const tao::binary_view v, const pegtl::position& p )
       {
-         binary( std::vector< std::byte >( v.data(), v.data() + v.size() ), p );
+         value.emplace( std::in_place_type< internal::binary_t >, std::vector< std::byte >( v.data(), v.data() + v.size() ), p );
       }
 
       void binary( std::vector< std::byte >&& v, const pegtl::position& p )
       {
-         value.emplace( internal::binary_t( std::move( v ), p ) );
+         value.emplace( std::in_place_type< internal::binary_t >, std::move( v ), p );
       }
 
       void begin_array( const pegtl::position& p )
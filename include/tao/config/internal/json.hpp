@@ -10,17 +10,50 @@
 #include <tao/json/contrib/traits.hpp>  // TODO: This might be a problem...
 
 #include "pegtl.hpp"
+#include "whitespace.hpp"
 
 namespace tao::config::internal::rules
 {
    namespace jaxn = tao::json::jaxn::internal::rules;
 
+   // Equivalent to pegtl::star< jaxn::ws > with a fast path for plain whitespace and
+   // ASCII comments; everything else, including errors, is handled by jaxn::ws.
+
    struct wss
-      : pegtl::star< jaxn::ws >
-   {};
+   {
+      using rule_t = wss;
+      using subs_t = pegtl::type_list< jaxn::ws >;
+
+      template< pegtl::apply_mode A,
+                pegtl::rewind_mode M,
+                template< typename... >
+                class Action,
+                template< typename... >
+                class Control,
+                typename ParseInput,
+                typename... States >
+      [[nodiscard]] static bool match( ParseInput& in, States&&... st )
+      {
+         while( true ) {
+            skip_blanks( in );
+
+            if( in.empty() ) {
+               return true;
+            }
+            if( ( in.peek_char() != '#' ) && ( in.peek_char() != '/' ) ) {
+               return true;
+            }
+            if( !skip_ascii_comment( in ) ) {
+               if( !Control< jaxn::ws >::template match< A, pegtl::rewind_mode::required, Action, Control >( in, st... ) ) {
+                  return true;
+               }
+            }
+         }
+      }
+   };
 
    struct wsp
-      : pegtl::plus< jaxn::ws >
+      : pegtl::seq< jaxn::ws, wss >
    {};
 
 }  // namespace tao::config::internal::rules
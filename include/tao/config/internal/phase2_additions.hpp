@@ -92,6 +92,7 @@ namespace tao::config::internal
                      continue;
                   }
                   r->get_string_atom().value = l->get_string() + r->get_string();
+                  r->get_string_atom().verbatim = false;
                   break;
 
                case entry_kind::BINARY:
@@ -5,8 +5,12 @@
 #define TAO_CONFIG_INTERNAL_PHASE2_FUNCTIONS_HPP
 
 #include <cstddef>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "array.hpp"
 #include "concat.hpp"
@@ -14,9 +18,12 @@
 #include "config_grammar.hpp"
 #include "entry.hpp"
 #include "forward.hpp"
+#include "function_implementations.hpp"
+#include "function_memo.hpp"
 #include "function_traits.hpp"
 #include "object.hpp"
 #include "pegtl.hpp"
+#include "shell_runner.hpp"
 #include "state.hpp"
 
 namespace tao::config::internal
@@ -30,6 +37,8 @@ namespace tao::config::internal
 
       [[nodiscard]] std::size_t process()
       {
+         process_shell_functions();
+
          for( auto& p : m_state.root.object ) {
             process_concat( p.second );
          }
@@ -41,6 +50,70 @@ namespace tao::config::internal
       std::size_t m_changes = 0;
       const function_map& m_functions;
 
+      std::vector< std::pair< entry*, shell_job > > m_shell;
+
+      // Runs all ready calls of the built-in shell function concurrently. The tree is not modified
+      // while the calls are collected, so the entry pointers remain valid until the results are
+      // put in place; calls that become ready later in this pass are run one at a time as usual.
+
+      void process_shell_functions()
+      {
+#if !defined( _MSC_VER )
+         const auto i = m_functions.find( "shell" );
+
+         if( ( i == m_functions.end() ) || ( i->second.target< shell_function >() == nullptr ) ) {
+            return;
+         }
+         for( auto& p : m_state.root.object ) {
+            collect_shell_concat( p.second );
+         }
+         if( m_shell.empty() ) {
+            return;
+         }
+         std::vector< shell_job* > jobs;
+         jobs.reserve( m_shell.size() );
+
+         for( auto& p : m_shell ) {
+            jobs.emplace_back( &p.second );
+         }
+         shell_run( jobs, m_state.shell );
+
+         for( auto& [ e, j ] : m_shell ) {
+            shell_function_put( *e, j, m_state.shell );
+            ++m_changes;
+         }
+#endif
+      }
+
+      void collect_shell_concat( concat& c )
+      {
+         for( auto& e : c.concat ) {
+            collect_shell_entry( e );
+         }
+      }
+
+      void collect_shell_entry( entry& e )
+      {
+         if( e.is_object() ) {
+            for( auto& p : e.get_object().object ) {
+               collect_shell_concat( p.second );
+            }
+         }
+         else if( e.is_array() ) {
+            array& a = e.get_array();
+            for( auto& c : a.array ) {
+               collect_shell_concat( c );
+            }
+            if( ( a.function == "shell" ) && ( a.array.size() == 1 ) ) {
+               try {
+                  m_shell.emplace_back( &e, shell_job( function_traits< std::string >::get( argument_view( a ), 0 ), a.position, m_state.shell.binary ) );
+               }
+               catch( const arguments_unready& ) {
+               }
+            }
+         }
+      }
+
       void process_concat( concat& c )
       {
          for( auto& e : c.concat ) {
@@ -82,37 +155,61 @@ namespace tao::config::internal
       void process_function( entry& e )
       {
          array& a = e.get_array();
+         const pegtl::position p = a.position;
+         std::optional< std::string > k;
 
-         if( a.function == "parse" ) {
-            process_parse_function( e, a );
+         if( m_state.memo.is_pure( a.function ) ) {
+            k = function_memo_key( a );
+            if( k ) {
+               if( const function_memo_result* r = m_state.memo.find( *k ) ) {
+                  e = r->value;
+                  function_memo_position( e, r->position, p );
+                  ++m_changes;
+                  return;
+               }
+            }
+         }
+         if( process_function_impl( e, a ) ) {
             ++m_changes;
-            return;
+            if( k ) {
+               m_state.memo.insert( std::move( *k ), p, e );
+            }
+         }
+      }
+
+      [[nodiscard]] bool process_function_impl( entry& e, array& a )
+      {
+         if( a.function == "parse" ) {
+            return process_parse_function( e, a );
          }
          const auto i = m_functions.find( a.function );
 
          if( i == m_functions.end() ) {
             throw pegtl::parse_error( "unknown function name " + a.function, a.position );
          }
-         if( i->second( e ) ) {
-            ++m_changes;
-         }
+         return i->second( e );
       }
 
-      void process_parse_function( entry& e, array& a )
+      // Parses the argument in place, i.e. without copying it, into a temporary state and moves the
+      // single resulting value into the call's place; repeated calls with the same string are taken
+      // from the memo by process_function() since parse is a pure function.
+
+      [[nodiscard]] bool process_parse_function( entry& e, array& a )
       {
          try {
             state st;
-            std::size_t i = 0;
-            const std::string s = function_traits< std::string >::get( a, i );
+            const std::string_view s = function_traits< std::string_view >::get( argument_view( a ), 0 );
             const key1 k = { key1_part( std::string( "\0", 1 ), a.position ) };
             const key1_guard kg( st, key1( k ) );
-            pegtl::string_input< pegtl::tracking_mode::eager, pegtl_input_t::eol_t > in( s, __FUNCTION__ );
-            pegtl::parse_nested< rules::value, config_action >( a.position, static_cast< pegtl_input_t& >( in ), st, m_functions );
+            pegtl_input_t in( s.data(), s.size(), __FUNCTION__ );
+            pegtl::parse_nested< rules::value, config_action >( a.position, in, st, m_functions );
             assert( st.root.object.size() == 1 );
             assert( st.root.object.begin()->second.concat.size() == 1 );
-            e = st.root.object.begin()->second.concat.front();  // TODO: This is slightly hack-ish.
+            e = std::move( st.root.object.begin()->second.concat.front() );  // Invalidates a and s.
+            return true;
          }
          catch( const arguments_unready& ) {
+            return false;
          }
       }
    };
@@ -6,9 +6,12 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "annotation_registry.hpp"
 #include "array.hpp"
 #include "concat.hpp"
 #include "entry.hpp"
@@ -16,90 +19,174 @@
 #include "object.hpp"
 #include "repack_traits.hpp"
 
+#include "../annotation_table.hpp"
 #include "../key.hpp"
+#include "../key_chain.hpp"
 
 namespace tao::config::internal
 {
    template< template< typename... > class Traits >
-   void set_key_and_position( [[maybe_unused]] json::basic_value< Traits >& r, [[maybe_unused]] const key& k, [[maybe_unused]] const pegtl::position& p )
+   void set_key_and_position( [[maybe_unused]] json::basic_value< Traits >& r, [[maybe_unused]] const key_chain& k, [[maybe_unused]] const pegtl::position& p )
    {
-      if constexpr( has_set_key< json::basic_value< Traits > > ) {
+      if constexpr( has_set_key_chain< json::basic_value< Traits > > ) {
          r.set_key( k );
       }
+      else if constexpr( has_set_key< json::basic_value< Traits > > ) {
+         r.set_key( k.to_key() );
+      }
       if constexpr( has_set_position< json::basic_value< Traits > > ) {
          r.set_position( p );
       }
    }
 
+   // Annotates values either directly via set_key_and_position(), or, for public base classes
+   // that support it, by adding key and position to an annotation table and setting the id.
+   // The root must be annotated with root() which gives it a reference to the table.
+
    template< template< typename... > class Traits >
-   void phase5_repack( const key& k, json::events::to_basic_value< Traits >& consumer, const concat& c );
+   struct annotator
+   {
+      annotator() = default;
+
+      annotator( annotator&& ) = delete;
+      annotator( const annotator& ) = delete;
+
+      ~annotator()
+      {
+         if( table != nullptr ) {
+            annotation_registry::instance().release( table );
+         }
+      }
+
+      void operator=( annotator&& ) = delete;
+      void operator=( const annotator& ) = delete;
+
+      void operator()( json::basic_value< Traits >& r, const key_chain& k, const pegtl::position& p )
+      {
+         if constexpr( has_set_annotation< json::basic_value< Traits > > ) {
+            r.set_annotation( add( k, p ) );
+         }
+         else {
+            set_key_and_position( r, k, p );
+         }
+      }
+
+      void root( json::basic_value< Traits >& r, const key_chain& k, const pegtl::position& p )
+      {
+         if constexpr( has_set_annotation< json::basic_value< Traits > > ) {
+            const std::uint32_t id = ( r.annotation_id() != 0 ) ? r.annotation_id() : add( k, p );
+            annotation_registry::instance().retain( table );
+            r.set_annotation( id | annotation_registry::owner_bit );
+         }
+         else {
+            set_key_and_position( r, k, p );
+         }
+      }
+
+   private:
+      [[nodiscard]] std::uint32_t add( const key_chain& k, const pegtl::position& p )
+      {
+         if( table == nullptr ) {
+            table = annotation_registry::instance().create();
+         }
+         return annotation_registry::instance().add( table, k, p );
+      }
+
+      const annotation_table* table = nullptr;
+   };
 
    template< template< typename... > class Traits >
-   void phase5_repack( const key& k, json::events::to_basic_value< Traits >& consumer, const array& a )
+   struct phase5_consumer
+      : json::events::to_basic_value< Traits >
+   {
+      annotator< Traits > annotate;
+   };
+
+   // When Move is true the tree is owned by the caller and strings and binary data are moved
+   // into the result instead of being copied; this is why the tree is passed by non-const ref.
+
+   template< typename T, bool Move >
+   using phase5_ref_t = std::conditional_t< Move, T&, const T& >;
+
+   template< template< typename... > class Traits, bool Move >
+   void phase5_repack( const key_chain& k, phase5_consumer< Traits >& consumer, phase5_ref_t< concat, Move > c );
+
+   template< template< typename... > class Traits, bool Move >
+   void phase5_repack( const key_chain& k, phase5_consumer< Traits >& consumer, phase5_ref_t< array, Move > a )
    {
       consumer.begin_array( a.array.size() );
-      set_key_and_position( consumer.stack_.back(), k, a.position );
+      consumer.annotate( consumer.stack_.back(), k, a.position );
       std::size_t i = 0;
-      for( const auto& c : a.array ) {
-         phase5_repack( k + i++, consumer, c );
+      for( auto& c : a.array ) {
+         phase5_repack< Traits, Move >( k + i++, consumer, c );
          consumer.element();
       }
       consumer.end_array( a.array.size() );
    }
 
-   template< template< typename... > class Traits >
-   void phase5_repack( const key& k, json::events::to_basic_value< Traits >& consumer, const object& o )
+   template< template< typename... > class Traits, bool Move >
+   void phase5_repack( const key_chain& k, phase5_consumer< Traits >& consumer, phase5_ref_t< object, Move > o )
    {
       consumer.begin_object( o.object.size() );
-      set_key_and_position( consumer.stack_.back(), k, o.position );
-      for( const auto& p : o.object ) {
+      consumer.annotate( consumer.stack_.back(), k, o.position );
+      for( auto& p : o.object ) {
          consumer.key( p.first );
-         phase5_repack( k + p.first, consumer, p.second );
+         phase5_repack< Traits, Move >( k + p.first, consumer, p.second );
          consumer.member();
       }
       consumer.end_object( o.object.size() );
    }
 
-   template< template< typename... > class Traits >
-   void phase5_repack( const key& k, json::events::to_basic_value< Traits >& consumer, const entry& e )
+   template< template< typename... > class Traits, bool Move >
+   void phase5_repack( const key_chain& k, phase5_consumer< Traits >& consumer, phase5_ref_t< entry, Move > e )
    {
       switch( e.kind() ) {
          case entry_kind::NULL_:
             consumer.null();
-            set_key_and_position( consumer.value, k, e.get_position() );
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::BOOLEAN:
             consumer.boolean( e.get_boolean() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::SIGNED:
             consumer.number( e.get_signed() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::UNSIGNED:
             consumer.number( e.get_unsigned() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::DOUBLE:
             consumer.number( e.get_double() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::STRING:
-            consumer.string( e.get_string() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            if constexpr( Move ) {
+               consumer.string( std::move( e.get_string() ) );
+            }
+            else {
+               consumer.string( e.get_string() );
+            }
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::BINARY:
-            consumer.binary( e.get_binary() );
-            set_key_and_position( consumer.value, k, e.get_position() );
+            if constexpr( Move ) {
+               consumer.binary( std::move( e.get_binary() ) );
+            }
+            else {
+               consumer.binary( e.get_binary() );
+            }
+            consumer.annotate( consumer.value, k, e.get_position() );
             return;
          case entry_kind::ARRAY:
             if( !e.get_array().function.empty() ) {
                throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE -- must have been either eliminated or flagged as error earlier.
             }
-            phase5_repack( k, consumer, e.get_array() );
+            phase5_repack< Traits, Move >( k, consumer, e.get_array() );
             return;
          case entry_kind::OBJECT:
-            phase5_repack( k, consumer, e.get_object() );
+            phase5_repack< Traits, Move >( k, consumer, e.get_object() );
             return;
          case entry_kind::ASTERISK:
          case entry_kind::REFERENCE:
@@ -108,28 +195,38 @@ namespace tao::config::internal
       throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
    }
 
-   template< template< typename... > class Traits >
-   void phase5_repack( const key& k, json::events::to_basic_value< Traits >& consumer, const concat& c )
+   template< template< typename... > class Traits, bool Move >
+   void phase5_repack( const key_chain& k, phase5_consumer< Traits >& consumer, phase5_ref_t< concat, Move > c )
    {
       assert( c.concat.size() == 1 );  // This should be ensured by phase3_remove().
 
-      phase5_repack( k, consumer, c.concat.front() );
+      phase5_repack< Traits, Move >( k, consumer, c.concat.front() );
    }
 
    template< template< typename... > class Traits >
    [[nodiscard]] json::basic_value< Traits > phase5_repack( const concat& c )
    {
-      json::events::to_basic_value< Traits > consumer;
-      phase5_repack( key(), consumer, c );
+      phase5_consumer< Traits > consumer;
+      phase5_repack< Traits, false >( key_chain(), consumer, c );
+      consumer.annotate.root( consumer.value, key_chain(), c.concat.front().get_position() );
       return std::move( consumer.value );
    }
 
    template< template< typename... > class Traits >
    [[nodiscard]] json::basic_value< Traits > phase5_repack( const object& o )
    {
-      json::events::to_basic_value< Traits > consumer;
-      phase5_repack( key(), consumer, o );
-      set_key_and_position( consumer.value, key(), o.position );
+      phase5_consumer< Traits > consumer;
+      phase5_repack< Traits, false >( key_chain(), consumer, o );
+      consumer.annotate.root( consumer.value, key_chain(), o.position );
+      return std::move( consumer.value );
+   }
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits > phase5_repack( object&& o )
+   {
+      phase5_consumer< Traits > consumer;
+      phase5_repack< Traits, true >( key_chain(), consumer, o );
+      consumer.annotate.root( consumer.value, key_chain(), o.position );
       return std::move( consumer.value );
    }
 
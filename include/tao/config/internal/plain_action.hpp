@@ -0,0 +1,80 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_PLAIN_ACTION_HPP
+#define TAO_CONFIG_INTERNAL_PLAIN_ACTION_HPP
+
+#include "json.hpp"
+#include "pegtl.hpp"
+#include "plain_grammar.hpp"
+
+namespace tao::config::internal
+{
+   template< typename Rule >
+   struct plain_action
+      : pegtl::nothing< Rule >
+   {};
+
+   template<>
+   struct plain_action< rules::plain_assign >
+   {
+      template< typename State >
+      static void apply0( State& st )
+      {
+         st.assign();
+      }
+   };
+
+   template<>
+   struct plain_action< rules::plain_element_begin >
+   {
+      template< typename State >
+      static void apply0( State& st )
+      {
+         st.element();
+      }
+   };
+
+   template<>
+   struct plain_action< rules::plain_begin_array >
+   {
+      template< typename Input, typename State >
+      static void apply( const Input& in, State& st )
+      {
+         st.begin_container( json::empty_array, in.position() );
+      }
+   };
+
+   template<>
+   struct plain_action< rules::plain_end_array >
+   {
+      template< typename State >
+      static void apply0( State& st )
+      {
+         st.end_container();
+      }
+   };
+
+   template<>
+   struct plain_action< rules::plain_begin_object >
+   {
+      template< typename Input, typename State >
+      static void apply( const Input& in, State& st )
+      {
+         st.begin_container( json::empty_object, in.position() );
+      }
+   };
+
+   template<>
+   struct plain_action< rules::plain_end_object >
+   {
+      template< typename State >
+      static void apply0( State& st )
+      {
+         st.end_container();
+      }
+   };
+
+}  // namespace tao::config::internal
+
+#endif
@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_PLAIN_GRAMMAR_HPP
+#define TAO_CONFIG_INTERNAL_PLAIN_GRAMMAR_HPP
+
+#include "config_grammar.hpp"
+#include "jaxn_action.hpp"
+#include "json.hpp"
+#include "key1_kind.hpp"
+#include "parse_utility.hpp"
+#include "pegtl.hpp"
+
+namespace tao::config::internal::rules
+{
+   // The subset of the config grammar without references, functions, asterisks,
+   // additions, appends, array indices in keys, delete, include and temporary.
+
+   struct plain_key
+   {
+      using rule_t = plain_key;
+      using subs_t = pegtl::type_list< key1_rule >;
+
+      template< pegtl::apply_mode A,
+                pegtl::rewind_mode M,
+                template< typename... >
+                class Action,
+                template< typename... >
+                class Control,
+                typename State >
+      [[nodiscard]] static bool match( pegtl_input_t& in, State& st )
+      {
+         st.member = parse_key1( in );
+
+         for( const auto& part : st.member ) {
+            if( part.kind() != key1_kind::name ) {
+               throw pegtl::parse_error( "plain config keys must consist of names", part.position );
+            }
+         }
+         return true;
+      }
+   };
+
+   struct plain_scalar
+   {
+      using rule_t = plain_scalar;
+      using subs_t = pegtl::type_list< json::jaxn::internal::rules::sor_single_value >;
+
+      template< pegtl::apply_mode A,
+                pegtl::rewind_mode M,
+                template< typename... >
+                class Action,
+                template< typename... >
+                class Control,
+                typename State >
+      [[nodiscard]] static bool match( pegtl_input_t& in, State& st )
+      {
+         typename State::consumer_t consumer( *st.target, st.target_key, st.annotate );
+         pegtl::parse< pegtl::must< json::jaxn::internal::rules::sor_single_value >, jaxn_action, json::jaxn::internal::errors >( in, consumer );
+         return true;
+      }
+   };
+
+   struct plain_array;
+   struct plain_object;
+
+   // clang-format off
+   struct plain_value : pegtl::sor< plain_array, plain_object, plain_scalar > {};
+
+   struct plain_assign : pegtl::one< ':', '=' > {};
+   struct plain_member : pegtl::must< plain_key, wss, plain_assign, wss, plain_value > {};
+
+   struct plain_element_begin : pegtl::success {};
+   struct plain_element : pegtl::seq< plain_element_begin, plain_value > {};
+
+   struct plain_begin_array : jaxn::begin_array {};
+   struct plain_end_array : jaxn::end_array {};
+   struct plain_begin_object : jaxn::begin_object {};
+   struct plain_end_object : jaxn::end_object {};
+
+   template< typename U > struct plain_member_list_impl : pegtl::until< U, plain_member, wss, opt_comma > {};
+
+   struct plain_element_list : pegtl::until< plain_end_array, plain_element, wss, opt_comma > {};
+   struct plain_array : pegtl::if_must< plain_begin_array, plain_element_list > {};
+   struct plain_object : pegtl::if_must< plain_begin_object, plain_member_list_impl< plain_end_object > > {};
+   struct plain_compat_file : pegtl::must< plain_member_list_impl< jaxn::end_object >, wss, pegtl::eof > {};
+   struct plain_config_list : plain_member_list_impl< pegtl::eof > {};
+   struct plain_file : pegtl::must< wss, pegtl::if_must_else< begin_compat, plain_compat_file, plain_config_list > > {};
+   // clang-format on
+
+}  // namespace tao::config::internal::rules
+
+#endif
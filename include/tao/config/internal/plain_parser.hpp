@@ -0,0 +1,30 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_PLAIN_PARSER_HPP
+#define TAO_CONFIG_INTERNAL_PLAIN_PARSER_HPP
+
+#include <utility>
+
+#include "json.hpp"
+#include "pegtl.hpp"
+#include "plain_action.hpp"
+#include "plain_grammar.hpp"
+#include "plain_state.hpp"
+
+namespace tao::config::internal
+{
+   // Throws a pegtl::parse_error for all inputs that are not plain, including
+   // those that are valid config files that require the full pipeline.
+
+   template< template< typename... > class Traits >
+   [[nodiscard]] json::basic_value< Traits > plain_parse( pegtl_input_t&& in )
+   {
+      plain_state< Traits > st;
+      pegtl::parse< rules::plain_file, plain_action >( in, st );
+      return std::move( st.root );
+   }
+
+}  // namespace tao::config::internal
+
+#endif
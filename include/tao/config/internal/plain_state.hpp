@@ -0,0 +1,248 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_PLAIN_STATE_HPP
+#define TAO_CONFIG_INTERNAL_PLAIN_STATE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+#include "key1.hpp"
+#include "limits.hpp"
+#include "pegtl.hpp"
+#include "phase5_repack.hpp"
+
+#include "../key_chain.hpp"
+
+namespace tao::config::internal
+{
+   // Receives the events for a single JAXN scalar value from jaxn_action and stores
+   // the final value, annotated with key and position, in the given target.
+
+   template< template< typename... > class Traits >
+   class plain_scalar_consumer
+   {
+   public:
+      plain_scalar_consumer( json::basic_value< Traits >& target, const key_chain& k, annotator< Traits >& a ) noexcept
+         : m_target( target ),
+           m_key( k ),
+           m_annotate( a )
+      {}
+
+      void null( const pegtl::position& p )
+      {
+         m_consumer.null();
+         finish( p );
+      }
+
+      void boolean( const bool v, const pegtl::position& p )
+      {
+         m_consumer.boolean( v );
+         finish( p );
+      }
+
+      void number( const std::int64_t v, const pegtl::position& p )
+      {
+         m_consumer.number( v );
+         finish( p );
+      }
+
+      void number( const std::uint64_t v, const pegtl::position& p )
+      {
+         m_consumer.number( v );
+         finish( p );
+      }
+
+      void number( const double v, const pegtl::position& p )
+      {
+         m_consumer.number( v );
+         finish( p );
+      }
+
+      void string( const std::string_view v, const pegtl::position& p )
+      {
+         m_consumer.string( v );
+         finish( p );
+      }
+
+      void string( std::string&& v, const pegtl::position& p, const bool /*unused*/ = false )
+      {
+         m_consumer.string( std::move( v ) );
+         finish( p );
+      }
+
+      void binary( const tao::binary_view v, const pegtl::position& p )
+      {
+         m_consumer.binary( v );
+         finish( p );
+      }
+
+      void binary( std::vector< std::byte >&& v, const pegtl::position& p )
+      {
+         m_consumer.binary( std::move( v ) );
+         finish( p );
+      }
+
+      // JAXN arrays and objects never get here since they are matched by the plain grammar first.
+
+      template< typename... Ts >
+      [[noreturn]] void begin_array( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void element( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void end_array( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void begin_object( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void key( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void member( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+      template< typename... Ts >
+      [[noreturn]] void end_object( const Ts&... /*unused*/ )
+      {
+         throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+      }
+
+   private:
+      void finish( const pegtl::position& p )
+      {
+         m_target = std::move( m_consumer.value );
+         m_annotate( m_target, m_key, p );
+      }
+
+      json::basic_value< Traits >& m_target;
+      const key_chain& m_key;
+      annotator< Traits >& m_annotate;
+      json::events::to_basic_value< Traits > m_consumer;
+   };
+
+   // The state for the plain fast path that builds the final value directly while parsing.
+   // It replicates what phase 1 to phase 5 would produce for the same input, including the
+   // positions of objects that are implicitly created by dotted keys, and throws a parse
+   // error for everything else so that the caller can fall back to the full pipeline.
+
+   template< template< typename... > class Traits >
+   struct plain_state
+   {
+      using consumer_t = plain_scalar_consumer< Traits >;
+
+      plain_state()
+         : root( json::empty_object )
+      {
+         annotate.root( root, key_chain(), pegtl::position( 1, 1, 1, "(root)" ) );
+         stack.emplace_back( &root );
+         keys.emplace_back();
+      }
+
+      plain_state( plain_state&& ) = delete;
+      plain_state( const plain_state& ) = delete;
+
+      ~plain_state() = default;
+
+      void operator=( plain_state&& ) = delete;
+      void operator=( const plain_state& ) = delete;
+
+      void assign()
+      {
+         assert( !member.empty() );
+         assert( stack.back()->is_object() );
+
+         if( keys.back().size() + member.size() >= global_nesting_limit ) {
+            throw pegtl::parse_error( "nesting depth exceeded", member.back().position );
+         }
+         json::basic_value< Traits >* v = stack.back();
+         target_key = keys.back();
+
+         for( std::size_t i = 0; i + 1 < member.size(); ++i ) {
+            const std::string& name = member[ i ].get_name();
+            target_key = target_key + name;
+            const auto [ j, b ] = v->get_object().try_emplace( name, json::empty_object );
+            if( b ) {
+               annotate( j->second, target_key, member[ i + 1 ].position );  // Consistent with phase1_append_name().
+            }
+            else if( !j->second.is_object() ) {
+               throw pegtl::parse_error( "plain config can not add members to non-object", member[ i ].position );
+            }
+            v = &j->second;
+         }
+         target_key = target_key + member.back().get_name();
+         target = &v->get_object()[ member.back().get_name() ];
+      }
+
+      void element()
+      {
+         assert( stack.back()->is_array() );
+
+         auto& a = stack.back()->get_array();
+         target_key = keys.back() + a.size();
+         target = &a.emplace_back();
+      }
+
+      template< typename T >
+      void begin_container( const T t, const pegtl::position& p )
+      {
+         assert( target != nullptr );
+
+         if( stack.size() >= global_nesting_limit ) {
+            throw pegtl::parse_error( "nesting depth exceeded", p );
+         }
+         *target = t;
+         annotate( *target, target_key, p );
+         stack.emplace_back( target );
+         keys.emplace_back( target_key );
+      }
+
+      void end_container()
+      {
+         assert( stack.size() > 1 );
+
+         stack.pop_back();
+         keys.pop_back();
+      }
+
+      annotator< Traits > annotate;
+      json::basic_value< Traits > root;
+
+      std::vector< json::basic_value< Traits >* > stack;  // The objects and arrays currently being filled, starting with the root.
+      std::vector< key_chain > keys;                      // The keys of the values on the stack.
+
+      json::basic_value< Traits >* target = nullptr;  // Where the next value goes, i.e. an object member or an array element.
+      key_chain target_key;
+
+      key1 member;
+   };
+
+}  // namespace tao::config::internal
+
+#endif
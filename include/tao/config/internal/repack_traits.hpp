@@ -4,9 +4,11 @@
 #ifndef TAO_CONFIG_INTERNAL_REPACK_TRAITS_HPP
 #define TAO_CONFIG_INTERNAL_REPACK_TRAITS_HPP
 
+#include <cstdint>
 #include <utility>
 
 #include "../key.hpp"
+#include "../key_chain.hpp"
 
 #include "pegtl.hpp"
 
@@ -18,6 +20,18 @@ namespace tao::config::internal
    template< typename V >
    inline constexpr bool has_set_key< V, decltype( std::declval< V >().public_base().set_key( std::declval< const config::key& >() ), void() ) > = true;
 
+   template< typename V, typename = void >
+   inline constexpr bool has_set_key_chain = false;
+
+   template< typename V >
+   inline constexpr bool has_set_key_chain< V, decltype( std::declval< V >().public_base().set_key( std::declval< const config::key_chain& >() ), void() ) > = true;
+
+   template< typename V, typename = void >
+   inline constexpr bool has_set_annotation = false;
+
+   template< typename V >
+   inline constexpr bool has_set_annotation< V, decltype( std::declval< V >().public_base().set_annotation( std::uint32_t() ), void() ) > = true;
+
    template< typename V, typename = void >
    inline constexpr bool has_set_position = false;
 
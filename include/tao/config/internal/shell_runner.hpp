@@ -0,0 +1,323 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_SHELL_RUNNER_HPP
+#define TAO_CONFIG_INTERNAL_SHELL_RUNNER_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if !defined( _MSC_VER )
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+#include "pegtl.hpp"
+#include "string_utility.hpp"
+
+namespace tao::config::internal
+{
+   struct shell_options
+   {
+      std::size_t concurrency = 8;
+      std::chrono::milliseconds timeout = std::chrono::milliseconds::zero();  // Zero for no timeout.
+      std::size_t max_output = std::size_t( 1 ) << 26;  // Zero for no limit.
+      bool binary = false;  // Whether the output is returned as binary data instead of as string.
+   };
+
+   // At most this much of the standard error output of a script is kept for error messages.
+
+   inline constexpr std::size_t shell_max_errors = 4096;
+
+   struct shell_job
+   {
+      shell_job( std::string&& s, const pegtl::position& p, const bool b )
+         : script( std::move( s ) ),
+           position( p ),
+           binary( b )
+      {}
+
+      std::string script;
+      pegtl::position position;
+      bool binary;
+
+      std::string output;  // Used unless binary.
+      std::vector< std::byte > binary_output;  // Used when binary.
+      std::string errors;
+
+      int status = 0;  // As returned by waitpid().
+      int spawn_errno = 0;
+      bool timed_out = false;
+      bool overflowed = false;
+   };
+
+#if !defined( _MSC_VER )
+   struct shell_process
+   {
+      shell_job* job;
+      pid_t pid;
+      int out;  // Negative after end-of-file.
+      int err;  // Negative after end-of-file.
+      std::chrono::steady_clock::time_point deadline;
+   };
+
+   [[nodiscard]] inline bool shell_cloexec_pipe( int ( &fds )[ 2 ] ) noexcept
+   {
+      if( ::pipe( fds ) != 0 ) {
+         return false;
+      }
+      // The read ends must not be inherited by the other concurrently running scripts, the write ends are dup2'ed to stdout and stderr.
+      ::fcntl( fds[ 0 ], F_SETFD, FD_CLOEXEC );
+      ::fcntl( fds[ 1 ], F_SETFD, FD_CLOEXEC );
+      return true;
+   }
+
+   [[nodiscard]] inline bool shell_spawn( shell_job& job, shell_process& proc ) noexcept
+   {
+      int out[ 2 ];
+      int err[ 2 ];
+
+      if( !shell_cloexec_pipe( out ) ) {
+         job.spawn_errno = errno;
+         return false;
+      }
+      if( !shell_cloexec_pipe( err ) ) {
+         job.spawn_errno = errno;
+         ::close( out[ 0 ] );
+         ::close( out[ 1 ] );
+         return false;
+      }
+      posix_spawn_file_actions_t fa;
+      ::posix_spawn_file_actions_init( &fa );
+      ::posix_spawn_file_actions_adddup2( &fa, out[ 1 ], 1 );
+      ::posix_spawn_file_actions_adddup2( &fa, err[ 1 ], 2 );
+
+      // Every script gets its own process group so that shell_kill() also reaches the processes started by the script.
+      posix_spawnattr_t sa;
+      ::posix_spawnattr_init( &sa );
+      ::posix_spawnattr_setflags( &sa, POSIX_SPAWN_SETPGROUP );
+      ::posix_spawnattr_setpgroup( &sa, 0 );
+
+      char* argv[] = { const_cast< char* >( "sh" ), const_cast< char* >( "-c" ), const_cast< char* >( job.script.c_str() ), nullptr };
+      const int r = ::posix_spawn( &proc.pid, "/bin/sh", &fa, &sa, argv, environ );
+
+      ::posix_spawnattr_destroy( &sa );
+      ::posix_spawn_file_actions_destroy( &fa );
+      ::close( out[ 1 ] );
+      ::close( err[ 1 ] );
+
+      if( r != 0 ) {
+         ::close( out[ 0 ] );
+         ::close( err[ 0 ] );
+         job.spawn_errno = r;
+         return false;
+      }
+      proc.job = &job;
+      proc.out = out[ 0 ];
+      proc.err = err[ 0 ];
+      return true;
+   }
+
+   inline void shell_close( int& fd ) noexcept
+   {
+      if( fd >= 0 ) {
+         ::close( fd );
+         fd = -1;
+      }
+   }
+
+   inline void shell_kill( const shell_process& proc ) noexcept
+   {
+      ::kill( -proc.pid, SIGKILL );
+   }
+
+   inline void shell_reap( shell_process& proc ) noexcept
+   {
+      shell_close( proc.out );
+      shell_close( proc.err );
+      while( ( ::waitpid( proc.pid, &proc.job->status, 0 ) < 0 ) && ( errno == EINTR ) ) {
+      }
+   }
+
+   [[nodiscard]] inline bool shell_eof( const ::ssize_t r, const int e ) noexcept
+   {
+      return ( r == 0 ) || ( ( r < 0 ) && ( e != EINTR ) && ( e != EAGAIN ) );
+   }
+
+   // Reads directly into the end of the string or vector that ends up in the entry. The size of the
+   // reads grows with the output from 4KiB to 1MiB, the container grows geometrically as usual. At
+   // most one byte more than the limit, unless it is zero, is read in order to detect overflows.
+   // Returns true on end-of-file.
+
+   template< typename C >
+   [[nodiscard]] bool shell_read_output( const int fd, C& c, const std::size_t limit )
+   {
+      const std::size_t size = c.size();
+      std::size_t n = std::clamp( size, std::size_t( 4096 ), std::size_t( 1 ) << 20 );
+      if( limit != 0 ) {
+         n = ( std::min )( n, limit + 1 - size );
+      }
+      c.resize( size + n );
+      const auto r = ::read( fd, reinterpret_cast< char* >( c.data() ) + size, n );
+      const int e = errno;
+      c.resize( size + ( ( r > 0 ) ? std::size_t( r ) : 0 ) );
+      return shell_eof( r, e );
+   }
+
+   [[nodiscard]] inline bool shell_read_output( shell_process& proc, const std::size_t limit )
+   {
+      shell_job& job = *proc.job;
+      const bool eof = job.binary ? shell_read_output( proc.out, job.binary_output, limit ) : shell_read_output( proc.out, job.output, limit );
+      job.overflowed = ( limit != 0 ) && ( ( job.binary ? job.binary_output.size() : job.output.size() ) > limit );
+      return eof;
+   }
+
+   // Keeps the beginning of the standard error output and discards the rest so that the script never blocks.
+
+   [[nodiscard]] inline bool shell_read_errors( shell_process& proc )
+   {
+      char buffer[ 4096 ];
+      const auto r = ::read( proc.err, buffer, sizeof( buffer ) );
+      const int e = errno;
+
+      if( r > 0 ) {
+         std::string& errors = proc.job->errors;
+         errors.append( buffer, ( std::min )( std::size_t( r ), shell_max_errors - errors.size() ) );
+      }
+      return shell_eof( r, e );
+   }
+
+   [[nodiscard]] inline int shell_poll_timeout( const std::vector< shell_process >& procs, const std::chrono::milliseconds timeout )
+   {
+      if( timeout == std::chrono::milliseconds::zero() ) {
+         return -1;
+      }
+      auto deadline = procs.front().deadline;
+      for( const auto& p : procs ) {
+         deadline = ( std::min )( deadline, p.deadline );
+      }
+      const auto now = std::chrono::steady_clock::now();
+      return ( deadline <= now ) ? 0 : int( std::chrono::ceil< std::chrono::milliseconds >( deadline - now ).count() );
+   }
+
+   // Runs the scripts of all jobs as concurrent processes, at most the configured number at a time,
+   // and collects their standard output and error with a single poll() loop. Processes that take
+   // longer than the timeout, or that produce more output than the limit, are killed. Errors are
+   // recorded in the jobs, see shell_job_check().
+
+   inline void shell_run( std::vector< shell_job* >& jobs, const shell_options& options )
+   {
+      std::vector< shell_process > procs;
+      std::vector< ::pollfd > fds;
+      std::size_t next = 0;
+
+      while( ( next < jobs.size() ) || !procs.empty() ) {
+         while( ( next < jobs.size() ) && ( procs.size() < ( std::max )( options.concurrency, std::size_t( 1 ) ) ) ) {
+            shell_process p;
+            if( shell_spawn( *jobs[ next++ ], p ) ) {
+               p.deadline = std::chrono::steady_clock::now() + options.timeout;
+               procs.emplace_back( p );
+            }
+         }
+         if( procs.empty() ) {
+            continue;
+         }
+         fds.clear();
+         for( const auto& p : procs ) {
+            fds.push_back( ::pollfd{ p.out, POLLIN, 0 } );  // Negative file descriptors are ignored by poll().
+            fds.push_back( ::pollfd{ p.err, POLLIN, 0 } );
+         }
+         if( ::poll( fds.data(), ::nfds_t( fds.size() ), shell_poll_timeout( procs, options.timeout ) ) < 0 ) {
+            if( errno == EINTR ) {
+               continue;
+            }
+            const int e = errno;
+            for( auto& p : procs ) {
+               shell_kill( p );
+               shell_reap( p );
+            }
+            throw std::system_error( e, std::system_category(), "poll() failed while running shell scripts" );  // LCOV_EXCL_LINE
+         }
+         const auto now = std::chrono::steady_clock::now();
+
+         for( std::size_t i = procs.size(); i-- > 0; ) {
+            shell_process& p = procs[ i ];
+
+            if( ( fds[ 2 * i ].revents != 0 ) && shell_read_output( p, options.max_output ) ) {
+               shell_close( p.out );
+            }
+            if( ( fds[ 2 * i + 1 ].revents != 0 ) && shell_read_errors( p ) ) {
+               shell_close( p.err );
+            }
+            bool done = ( p.out < 0 ) && ( p.err < 0 );
+
+            if( ( !done ) && p.job->overflowed ) {
+               shell_kill( p );
+               done = true;
+            }
+            if( ( !done ) && ( options.timeout != std::chrono::milliseconds::zero() ) && ( p.deadline <= now ) ) {
+               shell_kill( p );
+               p.job->timed_out = true;
+               done = true;
+            }
+            if( done ) {
+               shell_reap( p );
+               procs.erase( procs.begin() + std::ptrdiff_t( i ) );
+            }
+         }
+      }
+   }
+
+   [[nodiscard]] inline std::string shell_errors( const shell_job& job )
+   {
+      std::string_view e = job.errors;
+      while( ( !e.empty() ) && ( std::strchr( " \t\r\n", e.back() ) != nullptr ) ) {
+         e.remove_suffix( 1 );
+      }
+      return e.empty() ? std::string() : strcat( " -- ", e );
+   }
+#endif
+
+   // Throws an exception with the reason when the job did not complete successfully.
+
+   inline void shell_job_check( const shell_job& job, [[maybe_unused]] const shell_options& options )
+   {
+#if defined( _MSC_VER )
+      throw pegtl::parse_error( "shell extension not supported on this platform", job.position );
+#else
+      if( job.spawn_errno != 0 ) {
+         throw pegtl::parse_error( strcat( "unable to start shell script -- ", std::system_category().message( job.spawn_errno ) ), job.position );
+      }
+      if( job.timed_out ) {
+         throw pegtl::parse_error( strcat( "shell script timed out after ", options.timeout.count(), "ms", shell_errors( job ) ), job.position );
+      }
+      if( job.overflowed ) {
+         throw pegtl::parse_error( strcat( "shell script output exceeds the limit of ", options.max_output, " bytes" ), job.position );
+      }
+      if( WIFSIGNALED( job.status ) ) {
+         throw pegtl::parse_error( strcat( "shell script killed by signal ", WTERMSIG( job.status ), shell_errors( job ) ), job.position );
+      }
+      if( !WIFEXITED( job.status ) || ( WEXITSTATUS( job.status ) != 0 ) ) {
+         throw pegtl::parse_error( strcat( "shell script failed with exit status ", WEXITSTATUS( job.status ), shell_errors( job ) ), job.position );
+      }
+#endif
+   }
+
+}  // namespace tao::config::internal
+
+#endif
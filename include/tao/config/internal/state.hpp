@@ -5,10 +5,18 @@
 #define TAO_CONFIG_INTERNAL_STATE_HPP
 
 #include <cstdint>
+#include <memory>
 
+#include "../environment.hpp"
+#include "../file_cache.hpp"
+#include "../input_manifest.hpp"
+
+#include "function_memo.hpp"
+#include "include_prefetch.hpp"
 #include "key1.hpp"
 #include "object.hpp"
 #include "pegtl.hpp"
+#include "shell_runner.hpp"
 
 namespace tao::config::internal
 {
@@ -34,6 +42,14 @@ namespace tao::config::internal
 
       bool include_is_optional;
       std::uint64_t generation = 1;
+
+      std::shared_ptr< file_cache > cache;
+      std::shared_ptr< input_manifest > manifest;
+      std::unique_ptr< include_prefetch > prefetch;
+      std::shared_ptr< const environment > env;  // Snapshot of the process environment taken on first use unless set.
+
+      shell_options shell;
+      function_memo memo;
    };
 
 }  // namespace tao::config::internal
@@ -4,38 +4,57 @@
 #ifndef TAO_CONFIG_INTERNAL_STRING_UTILITY_HPP
 #define TAO_CONFIG_INTERNAL_STRING_UTILITY_HPP
 
+#include <charconv>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "entry_kind.hpp"
 #include "json.hpp"
 
 namespace tao::config::internal
 {
-   struct strcat_stream
-   {
-      std::ostringstream oss;
-   };
+   // Strings and integers are appended directly, other types fall back to their operator<<.
 
    template< typename T >
-   strcat_stream& operator<<=( strcat_stream& ss, const T& t )
+   void strcat_append( std::string& s, const T& t )
+   {
+      if constexpr( std::is_same_v< T, char > ) {
+         s += t;
+      }
+      else if constexpr( std::is_integral_v< T > && !std::is_same_v< T, bool > && !std::is_same_v< T, signed char > && !std::is_same_v< T, unsigned char > ) {
+         char b[ 24 ];
+         const auto r = std::to_chars( b, b + sizeof( b ), t );
+         s.append( b, r.ptr - b );
+      }
+      else if constexpr( std::is_convertible_v< const T&, std::string_view > ) {
+         s += std::string_view( t );
+      }
+      else {
+         std::ostringstream oss;
+         oss << t;
+         s += std::move( oss ).str();
+      }
+   }
+
+   inline void strcat_append( std::string& s, const json::type t )
    {
-      ss.oss << t;
-      return ss;
+      s += json::to_string( t );
    }
 
-   inline strcat_stream& operator<<=( strcat_stream& ss, const json::type t )
+   inline void strcat_append( std::string& s, const entry_kind k )
    {
-      ss.oss << json::to_string( t );
-      return ss;
+      s += to_string( k );
    }
 
    template< typename... Ts >
    [[nodiscard]] std::string strcat( const Ts&... ts )
    {
-      strcat_stream ss;
-      (void)( ss <<= ... <<= ts );
-      return std::move( ss.oss ).str();
+      std::string s;
+      ( strcat_append( s, ts ), ... );
+      return s;
    }
 
 }  // namespace tao::config::internal
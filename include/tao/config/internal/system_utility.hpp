@@ -4,14 +4,16 @@
 #ifndef TAO_CONFIG_INTERNAL_SYSTEM_UTILITY_HPP
 #define TAO_CONFIG_INTERNAL_SYSTEM_UTILITY_HPP
 
-#include <stdio.h>
-
+#include <cstddef>
 #include <cstdlib>
-#include <memory>
+#include <filesystem>
+#include <fstream>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
+#include <vector>
 
 #include "pegtl.hpp"
 
@@ -24,68 +26,56 @@ namespace tao::config::internal
       return pegtl::internal::read_file_stdio( filename ).read_string();
    }
 
-   [[nodiscard]] inline std::optional< std::string > read_file_nothrow( const std::string& filename )
-   {
-      try {
-         return read_file_throws( filename );
-      }
-      catch( const std::system_error& ) {
-         return std::nullopt;
-      }
-   }
+   // Reads the file directly into the vector that ends up in the binary_t, without a temporary
+   // std::string; files without a size, e.g. pipes or in /proc, are read in chunks.
 
-   [[nodiscard]] inline std::optional< std::string > getenv_nothrow( const std::string& name )
+   [[nodiscard]] inline std::vector< std::byte > read_file_binary_throws( const std::string& filename )
    {
-#if defined( _MSC_VER )
-      char buffer[ 256 ];
-      std::size_t s = 0;
-      if( ::getenv_s( &s, buffer, name.c_str() ) == 0 ) {
-         if( s > 0 ) {
-            return std::string( buffer );
-         }
+      std::error_code ec;
+      const auto status = std::filesystem::status( filename, ec );
+
+      if( ec ) {
+         throw std::filesystem::filesystem_error( "unable to open file for reading", filename, ec );
       }
-      // TODO: Check s and try with a larger buffer
-#else
-      if( const char* r = std::getenv( name.c_str() ) ) {
-         return std::string( r );
+      if( std::filesystem::is_directory( status ) ) {
+         throw std::filesystem::filesystem_error( "unable to read file", filename, std::make_error_code( std::errc::is_a_directory ) );
       }
-#endif
-      return std::nullopt;
-   }
+      std::ifstream stream( filename, std::ios::binary );
 
-   [[nodiscard]] inline std::string getenv_throws( const pegtl::position& pos, const std::string& name )
-   {
-      if( auto result = getenv_nothrow( name ) ) {
-         return std::move( *result );
+      if( !stream ) {
+         // The streams do not report why a file could not be opened, the usual reason that remains after the status check is missing permissions.
+         throw std::filesystem::filesystem_error( "unable to open file for reading", filename, std::make_error_code( std::errc::permission_denied ) );
       }
-      throw pegtl::parse_error( "environment variable '" + name + "' not found", pos );
-   }
+      const auto size = std::filesystem::file_size( filename, ec );
 
-#if !defined( _MSC_VER )
-   [[nodiscard]] inline std::string shell_popen_throws( const pegtl::position& pos, const std::string& script )
-   {
-      errno = 0;
+      std::vector< std::byte > result( ec ? 0 : std::size_t( size ) );
+      std::size_t done = 0;
 
-      std::unique_ptr< FILE, void ( * )( FILE* ) > file( ::popen( script.c_str(), "r" ), []( FILE* f ) { ::pclose( f ); } );
+      while( true ) {
+         stream.read( reinterpret_cast< char* >( result.data() + done ), std::streamsize( result.size() - done ) );
+         done += std::size_t( stream.gcount() );
 
-      if( !file ) {
-         throw pegtl::parse_error( "TODO: Better error message for shell function popen error.", pos );
-         //         throw pegtl::parse_error( format( __FILE__, __LINE__, "popen failed", { { "command", script }, { "errno", errno } } ), pos );
+         if( stream.bad() ) {
+            throw std::filesystem::filesystem_error( "unable to read file", filename, std::make_error_code( std::errc::io_error ) );
+         }
+         if( ( !stream ) || ( stream.peek() == std::ifstream::traits_type::eof() ) ) {
+            break;
+         }
+         result.resize( result.size() + 4096 );
       }
-      std::string result;
-      char buffer[ 1000 ];
+      result.resize( done );
+      return result;
+   }
 
-      while( const auto temp = ::fread( buffer, 1, sizeof( buffer ), file.get() ) ) {
-         result.append( buffer, temp );
+   [[nodiscard]] inline std::optional< std::string > read_file_nothrow( const std::string& filename )
+   {
+      try {
+         return read_file_throws( filename );
       }
-      errno = 0;
-
-      if( ::pclose( file.release() ) != 0 ) {
-         throw pegtl::parse_error( "TODO: Better error message for shell function pclose error.", pos );  // LCOV_EXCL_LINE
+      catch( const std::system_error& ) {
+         return std::nullopt;
       }
-      return result;
    }
-#endif
 
 }  // namespace tao::config::internal
 
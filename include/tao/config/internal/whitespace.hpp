@@ -0,0 +1,147 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_INTERNAL_WHITESPACE_HPP
+#define TAO_CONFIG_INTERNAL_WHITESPACE_HPP
+
+#include <cassert>
+#include <cstddef>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+#endif
+
+#include "pegtl.hpp"
+
+namespace tao::config::internal
+{
+#if defined( __SSE2__ )
+   // Not every compiler that defines __SSE2__ has __builtin_ctz(), e.g. MSVC compatible ones.
+
+   [[nodiscard]] inline unsigned count_trailing_zeros( const unsigned m ) noexcept
+   {
+      assert( m != 0 );
+#if defined( __GNUC__ ) || defined( __clang__ )
+      return unsigned( __builtin_ctz( m ) );
+#elif defined( _MSC_VER )
+      unsigned long r;
+      _BitScanForward( &r, m );
+      return unsigned( r );
+#else
+      unsigned r = 0;
+      while( ( ( m >> r ) & 1 ) == 0 ) {
+         ++r;
+      }
+      return r;
+#endif
+   }
+#endif
+
+   // Skips ' ', '\t', '\r' and '\n' and updates the position of the input in bulk, one
+   // bump per line, instead of matching one pegtl::one<> per character. With SSE2 the
+   // (typically long) runs of spaces used for indentation are skipped 16 bytes at a time.
+
+   template< typename ParseInput >
+   void skip_blanks( ParseInput& in ) noexcept
+   {
+      const char* p = in.current();
+      const char* l = p;
+      const char* const e = in.end();
+
+      while( p != e ) {
+#if defined( __SSE2__ )
+         if( ( *p == ' ' ) && ( e - p >= 16 ) ) {
+            const __m128i c = _mm_loadu_si128( reinterpret_cast< const __m128i* >( p ) );
+            const unsigned m = unsigned( _mm_movemask_epi8( _mm_cmpeq_epi8( c, _mm_set1_epi8( ' ' ) ) ) );
+            p += ( m == 0xffff ) ? 16 : count_trailing_zeros( ~m );
+            continue;
+         }
+#endif
+         switch( *p ) {
+            case ' ':
+            case '\t':
+            case '\r':
+               ++p;
+               continue;
+            case '\n':
+               ++p;
+               in.bump_to_next_line( std::size_t( p - l ) );
+               l = p;
+               continue;
+            default:
+               break;
+         }
+         break;
+      }
+      in.bump_in_this_line( std::size_t( p - l ) );
+   }
+
+   [[nodiscard]] constexpr bool is_ascii_comment_char( const char c ) noexcept
+   {
+      return ( ( ' ' <= c ) && ( c <= '~' ) ) || ( c == '\t' );
+   }
+
+   // Skips a single '#', '//' or '/* */' comment that consists of printable ASCII characters
+   // and tabs, plus new-lines in block comments. Returns false without consuming anything for
+   // all other inputs, including comments with other characters, which are left to the grammar
+   // so that validation and error messages remain those of the JAXN comment rules.
+
+   template< typename ParseInput >
+   [[nodiscard]] bool skip_ascii_comment( ParseInput& in ) noexcept
+   {
+      const char* p = in.current();
+      const char* const e = in.end();
+
+      if( ( p != e ) && ( *p == '#' ) ) {
+         ++p;
+      }
+      else if( ( e - p >= 2 ) && ( p[ 0 ] == '/' ) && ( p[ 1 ] == '/' ) ) {
+         p += 2;
+      }
+      else if( ( e - p >= 2 ) && ( p[ 0 ] == '/' ) && ( p[ 1 ] == '*' ) ) {
+         p += 2;
+         const char* l = in.current();
+         std::size_t lines = 0;
+
+         for( ; ( p != e ) && ( *p != '*' || ( p + 1 == e ) || ( p[ 1 ] != '/' ) ); ++p ) {
+            if( *p == '\n' ) {
+               ++lines;
+            }
+            else if( !is_ascii_comment_char( *p ) ) {
+               return false;
+            }
+         }
+         if( p == e ) {
+            return false;
+         }
+         p += 2;
+
+         for( const char* q = l; lines > 0; ++q ) {
+            if( *q == '\n' ) {
+               in.bump_to_next_line( std::size_t( q + 1 - l ) );
+               l = q + 1;
+               --lines;
+            }
+         }
+         in.bump_in_this_line( std::size_t( p - l ) );
+         return true;
+      }
+      else {
+         return false;
+      }
+      while( ( p != e ) && is_ascii_comment_char( *p ) ) {
+         ++p;
+      }
+      if( ( p != e ) && ( *p != '\n' ) && ( ( *p != '\r' ) || ( p + 1 == e ) || ( p[ 1 ] != '\n' ) ) ) {
+         return false;
+      }
+      in.bump_in_this_line( std::size_t( p - in.current() ) );
+      return true;
+   }
+
+}  // namespace tao::config::internal
+
+#endif
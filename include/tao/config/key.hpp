@@ -4,7 +4,7 @@
 #ifndef TAO_CONFIG_INTERNAL_KEY_HPP
 #define TAO_CONFIG_INTERNAL_KEY_HPP
 
-#include <sstream>
+#include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -151,23 +151,30 @@ namespace tao::config
       return t;
    }
 
-   inline void to_stream( std::ostream& o, const key& p )
+   inline void append_to_string( std::string& s, const key& p )
    {
       if( !p.empty() ) {
-         to_stream( o, p[ 0 ] );
+         append_to_string( s, p[ 0 ] );
 
          for( std::size_t i = 1; i < p.size(); ++i ) {
-            o << '.';
-            to_stream( o, p[ i ] );
+            s += '.';
+            append_to_string( s, p[ i ] );
          }
       }
    }
 
+   inline void to_stream( std::ostream& o, const key& p )
+   {
+      std::string s;
+      append_to_string( s, p );
+      o << s;
+   }
+
    [[nodiscard]] inline std::string to_string( const key& p )
    {
-      std::ostringstream oss;
-      to_stream( oss, p );
-      return std::move( oss ).str();
+      std::string s;
+      append_to_string( s, p );
+      return s;
    }
 
 }  // namespace tao::config
@@ -0,0 +1,184 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_KEY_CHAIN_HPP
+#define TAO_CONFIG_KEY_CHAIN_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "key.hpp"
+#include "key_part.hpp"
+
+namespace tao::config
+{
+   // An immutable key represented as shared parent-pointer chain, appending a part
+   // to a key chain allocates a single node that shares all parts with the original.
+   // This is how the annotations store the keys, the children of a value share the
+   // nodes for their common prefix instead of each holding a full copy of the key.
+
+   class key_chain
+   {
+   public:
+      key_chain() noexcept = default;
+
+      explicit key_chain( const key& k )
+      {
+         for( const auto& p : k ) {
+            *this = *this + p;
+         }
+      }
+
+      [[nodiscard]] bool empty() const noexcept
+      {
+         return !m_node;
+      }
+
+      [[nodiscard]] std::size_t size() const noexcept
+      {
+         return m_node ? m_node->size : 0;
+      }
+
+      [[nodiscard]] const key_part& back() const noexcept
+      {
+         assert( m_node );
+         return m_node->part;
+      }
+
+      [[nodiscard]] key_chain parent() const noexcept
+      {
+         assert( m_node );
+         return key_chain( m_node->parent );
+      }
+
+      [[nodiscard]] key to_key() const
+      {
+         key result;
+         result.resize( size(), key_part( std::size_t( 0 ) ) );
+         std::size_t i = size();
+         for( const node* n = m_node.get(); n != nullptr; n = n->parent.get() ) {
+            result[ --i ] = n->part;
+         }
+         return result;
+      }
+
+      operator key() const
+      {
+         return to_key();
+      }
+
+      [[nodiscard]] friend key_chain operator+( const key_chain& l, key_part p )
+      {
+         return key_chain( std::make_shared< const node >( l.m_node, std::move( p ) ) );
+      }
+
+      [[nodiscard]] friend bool operator==( const key_chain& l, const key_chain& r ) noexcept
+      {
+         if( l.size() != r.size() ) {
+            return false;
+         }
+         for( const node *a = l.m_node.get(), *b = r.m_node.get(); a != b; a = a->parent.get(), b = b->parent.get() ) {
+            if( !( a->part == b->part ) ) {
+               return false;
+            }
+         }
+         return true;
+      }
+
+      [[nodiscard]] friend bool operator==( const key_chain& l, const key& r ) noexcept
+      {
+         if( l.size() != r.size() ) {
+            return false;
+         }
+         std::size_t i = r.size();
+         for( const node* n = l.m_node.get(); n != nullptr; n = n->parent.get() ) {
+            if( !( n->part == r[ --i ] ) ) {
+               return false;
+            }
+         }
+         return true;
+      }
+
+      friend void append_to_string( std::string& s, const key_chain& k )
+      {
+         if( !k.empty() ) {
+            append_to_string( s, k.parent() );
+            if( k.size() > 1 ) {
+               s += '.';
+            }
+            append_to_string( s, k.back() );
+         }
+      }
+
+   private:
+      struct node
+      {
+         node( std::shared_ptr< const node > p, key_part k ) noexcept
+            : parent( std::move( p ) ),
+              part( std::move( k ) ),
+              size( parent ? ( parent->size + 1 ) : 1 )
+         {}
+
+         std::shared_ptr< const node > parent;
+         key_part part;
+         std::size_t size;
+      };
+
+      explicit key_chain( std::shared_ptr< const node > n ) noexcept
+         : m_node( std::move( n ) )
+      {}
+
+      std::shared_ptr< const node > m_node;
+   };
+
+   [[nodiscard]] inline key_chain operator+( const key_chain& l, const std::size_t i )
+   {
+      return l + key_part( i );
+   }
+
+   [[nodiscard]] inline key_chain operator+( const key_chain& l, const std::string& n )
+   {
+      return l + key_part( n );
+   }
+
+   [[nodiscard]] inline bool operator==( const key& l, const key_chain& r ) noexcept
+   {
+      return r == l;
+   }
+
+   [[nodiscard]] inline bool operator!=( const key_chain& l, const key_chain& r ) noexcept
+   {
+      return !( l == r );
+   }
+
+   [[nodiscard]] inline bool operator!=( const key_chain& l, const key& r ) noexcept
+   {
+      return !( l == r );
+   }
+
+   [[nodiscard]] inline bool operator!=( const key& l, const key_chain& r ) noexcept
+   {
+      return !( l == r );
+   }
+
+   inline void to_stream( std::ostream& o, const key_chain& k )
+   {
+      std::string s;
+      append_to_string( s, k );
+      o << s;
+   }
+
+   [[nodiscard]] inline std::string to_string( const key_chain& k )
+   {
+      std::string s;
+      append_to_string( s, k );
+      return s;
+   }
+
+}  // namespace tao::config
+
+#endif
@@ -4,16 +4,18 @@
 #ifndef TAO_CONFIG_KEY_PART_HPP
 #define TAO_CONFIG_KEY_PART_HPP
 
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 
 #include "internal/constants.hpp"
 #include "internal/json.hpp"
-#include "internal/key_grammar.hpp"
-#include "internal/pegtl.hpp"
 
 #include "key_kind.hpp"
 
@@ -63,36 +65,157 @@ namespace tao::config
       return l.data == r.data;
    }
 
-   [[nodiscard]] inline bool is_identifier( const std::string& n )
+   namespace internal
    {
-      using grammar = pegtl::seq< internal::rules::ident, pegtl::eof >;
-      pegtl::memory_input< pegtl::tracking_mode::lazy, pegtl::eol::lf_crlf, const char* > in( n, __FUNCTION__ );
-      return pegtl::parse< grammar >( in );
+      // Character classes for rules::ident_first and rules::ident_other, a table lookup per
+      // character instead of running the grammar on a separate input for every name.
+
+      inline constexpr unsigned char ident_first_bit = 1;
+      inline constexpr unsigned char ident_other_bit = 2;
+
+      [[nodiscard]] constexpr std::array< unsigned char, 256 > make_ident_table() noexcept
+      {
+         std::array< unsigned char, 256 > r = {};
+         for( unsigned c = 'a'; c <= 'z'; ++c ) {
+            r[ c ] = ident_first_bit | ident_other_bit;
+            r[ c - 'a' + 'A' ] = ident_first_bit | ident_other_bit;
+         }
+         for( unsigned c = '0'; c <= '9'; ++c ) {
+            r[ c ] = ident_other_bit;
+         }
+         r[ '_' ] = ident_first_bit | ident_other_bit;
+         r[ '-' ] = ident_other_bit;
+         return r;
+      }
+
+      inline constexpr std::array< unsigned char, 256 > ident_table = make_ident_table();
+
+      [[nodiscard]] constexpr bool is_ident_first( const char c ) noexcept
+      {
+         return ( ident_table[ static_cast< unsigned char >( c ) ] & ident_first_bit ) != 0;
+      }
+
+      [[nodiscard]] constexpr bool is_ident_other( const char c ) noexcept
+      {
+         return ( ident_table[ static_cast< unsigned char >( c ) ] & ident_other_bit ) != 0;
+      }
+
+      // Appends the string with the same escaping as json::internal::escape(), used for all key output.
+
+      inline void escape_append( std::string& s, const std::string_view n )
+      {
+         static const char* h = "0123456789abcdef";
+
+         const char* p = n.data();
+         const char* l = p;
+         const char* const e = n.data() + n.size();
+
+         while( p != e ) {
+            const unsigned char c = static_cast< unsigned char >( *p );
+            if( ( c >= 0x20 ) && ( c != '"' ) && ( c != '\\' ) && ( c != 0x7f ) ) {
+               ++p;
+               continue;
+            }
+            s.append( l, p - l );
+            switch( c ) {
+               case '"':
+                  s += "\\\"";
+                  break;
+               case '\\':
+                  s += "\\\\";
+                  break;
+               case '\b':
+                  s += "\\b";
+                  break;
+               case '\f':
+                  s += "\\f";
+                  break;
+               case '\n':
+                  s += "\\n";
+                  break;
+               case '\r':
+                  s += "\\r";
+                  break;
+               case '\t':
+                  s += "\\t";
+                  break;
+               default:
+                  s += "\\u00";
+                  s += h[ ( c & 0xf0 ) >> 4 ];
+                  s += h[ c & 0x0f ];
+            }
+            l = ++p;
+         }
+         s.append( l, p - l );
+      }
+
+   }  // namespace internal
+
+   [[nodiscard]] constexpr bool is_identifier( const std::string_view n ) noexcept
+   {
+      if( n.empty() || !internal::is_ident_first( n[ 0 ] ) ) {
+         return false;
+      }
+      for( std::size_t i = 1; i < n.size(); ++i ) {
+         if( !internal::is_ident_other( n[ i ] ) ) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   inline void name_append( std::string& s, const std::string_view n )
+   {
+      if( is_identifier( n ) ) {
+         s += n;
+      }
+      else {
+         s += '"';
+         internal::escape_append( s, n );
+         s += '"';
+      }
    }
 
    [[nodiscard]] inline std::string name_to_string( const std::string& n )
    {
-      return is_identifier( n ) ? n : ( '"' + json::internal::escape( n ) + '"' );
+      std::string s;
+      name_append( s, n );
+      return s;
    }
 
-   [[nodiscard]] inline std::string to_string( const key_part& t )
+   inline void append_to_string( std::string& s, const key_part& t )
    {
       switch( t.kind() ) {
          case key_kind::name:
-            return name_to_string( t.get_name() );
-         case key_kind::index:
-            return std::to_string( t.get_index() );
+            name_append( s, t.get_name() );
+            return;
+         case key_kind::index: {
+            char b[ 24 ];
+            const auto r = std::to_chars( b, b + sizeof( b ), t.get_index() );
+            s.append( b, r.ptr );
+            return;
+         }
       }
       throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
    }
 
+   [[nodiscard]] inline std::string to_string( const key_part& t )
+   {
+      std::string s;
+      append_to_string( s, t );
+      return s;
+   }
+
    inline void name_to_stream( std::ostream& o, const std::string& n )
    {
       if( is_identifier( n ) ) {
          o << n;
       }
       else {
-         o << '"' << json::internal::escape( n ) << '"';
+         std::string s = "\"";
+         internal::escape_append( s, n );
+         s += '"';
+         o << s;
       }
    }
 
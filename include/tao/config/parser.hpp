@@ -4,6 +4,16 @@
 #ifndef TAO_CONFIG_PARSER_HPP
 #define TAO_CONFIG_PARSER_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "environment.hpp"
+#include "file_cache.hpp"
+#include "input_manifest.hpp"
+
 #include "internal/config_parser.hpp"
 #include "internal/function_wrapper.hpp"
 
@@ -24,10 +34,94 @@ namespace tao::config
          m_parser.parse( data, source );
       }
 
+      // Files that are parsed or included are read through the cache, which can be shared with other parsers;
+      // the cache saves reading the files again, not parsing them.
+
+      void set_file_cache( std::shared_ptr< file_cache > cache )
+      {
+         m_parser.st.cache = std::move( cache );
+         if( m_parser.st.prefetch ) {
+            set_include_prefetch( true, m_parser.st.prefetch->threads() );
+         }
+      }
+
+      // Reads all files included by subsequently parsed configs, recursively, into the file cache with
+      // at most the given number of worker threads, before the parser reaches the includes; creates a
+      // cache if necessary.
+
+      void set_include_prefetch( const bool prefetch, const std::size_t threads = internal::include_prefetch::default_threads )
+      {
+         m_parser.st.prefetch.reset();
+         if( prefetch ) {
+            if( !m_parser.st.cache ) {
+               m_parser.st.cache = std::make_shared< file_cache >();
+            }
+            m_parser.st.prefetch = std::make_unique< internal::include_prefetch >( m_parser.st.cache, threads );
+         }
+      }
+
+      // Records all files and environment variables consulted by subsequent parsing in the manifest.
+
+      void set_input_manifest( std::shared_ptr< input_manifest > manifest ) noexcept
+      {
+         m_parser.st.manifest = std::move( manifest );
+      }
+
+      // The env and env? functions look up variables in the given environment instead of a snapshot of the process environment.
+
+      void set_environment( std::shared_ptr< const environment > env ) noexcept
+      {
+         m_parser.st.env = std::move( env );
+      }
+
+      // All shell function calls that are ready at the same time are run as concurrent processes, at most limit at a time.
+
+      void set_shell_concurrency( const std::size_t limit ) noexcept
+      {
+         m_parser.st.shell.concurrency = limit;
+      }
+
+      // Shell function calls that take longer than the timeout are killed and fail; zero, the default, means no timeout.
+
+      void set_shell_timeout( const std::chrono::milliseconds timeout ) noexcept
+      {
+         m_parser.st.shell.timeout = timeout;
+      }
+
+      // Shell function calls that write more than the limit to stdout are killed and fail; zero means no limit, the default is 64MiB.
+
+      void set_shell_max_output( const std::size_t limit ) noexcept
+      {
+         m_parser.st.shell.max_output = limit;
+      }
+
+      // Shell function calls return their output as binary data instead of as string, without validating or copying it.
+
+      void set_shell_binary_output( const bool binary ) noexcept
+      {
+         m_parser.st.shell.binary = binary;
+      }
+
+      // Calls to pure extensions, i.e. extensions whose result only depends on their arguments,
+      // are evaluated only once for every distinct combination of argument values.
+
       template< typename F >
-      void set_inner_extension( const std::string& name, F& f )
+      void set_inner_extension( const std::string& name, F& f, const bool pure = false )
       {
          m_parser.fm[ name ] = internal::wrap( f );
+         m_parser.st.memo.set_pure( name, pure );
+      }
+
+      // The number of function calls whose result was re-used from, or added to, the memo of pure function calls.
+
+      [[nodiscard]] std::uint64_t memo_hits() const noexcept
+      {
+         return m_parser.st.memo.hits();
+      }
+
+      [[nodiscard]] std::uint64_t memo_misses() const noexcept
+      {
+         return m_parser.st.memo.misses();
       }
 
       template< template< typename... > class Traits >
@@ -0,0 +1,136 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_SPARSE_TRAITS_HPP
+#define TAO_CONFIG_SPARSE_TRAITS_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <utility>
+
+#include <tao/json.hpp>
+#include <tao/json/contrib/position.hpp>
+
+#include "annotation_table.hpp"
+#include "key_chain.hpp"
+
+#include "internal/annotation_registry.hpp"
+
+namespace tao::config
+{
+   // Alternative to annotation that only stores a 32-bit id; key and position are looked up
+   // on demand in the annotation table that is kept alive by the root value and its copies.
+
+   class sparse_annotation
+   {
+   public:
+      sparse_annotation() noexcept = default;
+
+      sparse_annotation( sparse_annotation&& a ) noexcept
+         : m_id( std::exchange( a.m_id, 0 ) )
+      {}
+
+      sparse_annotation( const sparse_annotation& a )
+         : m_id( a.m_id )
+      {
+         if( is_owner( m_id ) ) {
+            internal::annotation_registry::instance().retain( m_id );
+         }
+      }
+
+      sparse_annotation& operator=( sparse_annotation&& a ) noexcept
+      {
+         if( this != &a ) {
+            set_annotation( std::exchange( a.m_id, 0 ) );
+         }
+         return *this;
+      }
+
+      sparse_annotation& operator=( const sparse_annotation& a )
+      {
+         if( this != &a ) {
+            set_annotation( sparse_annotation( a ).release() );
+         }
+         return *this;
+      }
+
+      ~sparse_annotation()
+      {
+         set_annotation( 0 );
+      }
+
+      // Takes over the reference to the table when the id has the owner bit set.
+
+      void set_annotation( const std::uint32_t id ) noexcept
+      {
+         if( is_owner( m_id ) ) {
+            internal::annotation_registry::instance().release( m_id );
+         }
+         m_id = id;
+      }
+
+      [[nodiscard]] std::uint32_t annotation_id() const noexcept
+      {
+         return m_id;
+      }
+
+      [[nodiscard]] bool has_annotation() const
+      {
+         return internal::annotation_registry::instance().find( m_id, []( const annotation_table& /*unused*/, const std::uint32_t /*unused*/ ) {} );
+      }
+
+      [[nodiscard]] key_chain get_key() const
+      {
+         key_chain result;
+         (void)internal::annotation_registry::instance().find( m_id, [ & ]( const annotation_table& t, const std::uint32_t i ) { result = t.key( i ); } );
+         return result;
+      }
+
+      [[nodiscard]] json::position get_position() const
+      {
+         json::position result;
+         (void)internal::annotation_registry::instance().find( m_id, [ & ]( const annotation_table& t, const std::uint32_t i ) { result.set_position( t.position( i ) ); } );
+         return result;
+      }
+
+      void append_message_extension( std::ostream& o ) const
+      {
+         to_stream( o, get_key() );
+         o << ' ';
+         get_position().append_message_extension( o );
+      }
+
+   private:
+      [[nodiscard]] static bool is_owner( const std::uint32_t id ) noexcept
+      {
+         return ( id & internal::annotation_registry::owner_bit ) != 0;
+      }
+
+      [[nodiscard]] std::uint32_t release() noexcept
+      {
+         return std::exchange( m_id, 0 );
+      }
+
+      std::uint32_t m_id = 0;
+   };
+
+   template< typename T >
+   struct sparse_traits
+      : json::traits< T >
+   {};
+
+   template<>
+   struct sparse_traits< void >
+      : json::traits< void >
+   {
+      static constexpr const bool enable_implicit_constructor = false;
+
+      template< typename Value >
+      using public_base = sparse_annotation;
+   };
+
+   using sparse_value = json::basic_value< sparse_traits >;
+
+}  // namespace tao::config
+
+#endif
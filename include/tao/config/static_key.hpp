@@ -0,0 +1,203 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_STATIC_KEY_HPP
+#define TAO_CONFIG_STATIC_KEY_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "key.hpp"
+#include "key_kind.hpp"
+#include "key_part.hpp"
+
+namespace tao::config
+{
+   class static_key_part
+   {
+   public:
+      constexpr static_key_part() noexcept = default;
+
+      explicit constexpr static_key_part( const std::string_view n ) noexcept
+         : m_kind( key_kind::name ),
+           m_name( n )
+      {}
+
+      explicit constexpr static_key_part( const std::size_t i ) noexcept
+         : m_kind( key_kind::index ),
+           m_index( i )
+      {}
+
+      [[nodiscard]] constexpr key_kind kind() const noexcept
+      {
+         return m_kind;
+      }
+
+      [[nodiscard]] constexpr std::size_t get_index() const noexcept
+      {
+         return m_index;
+      }
+
+      [[nodiscard]] constexpr std::string_view get_name() const noexcept
+      {
+         return m_name;
+      }
+
+   private:
+      key_kind m_kind = key_kind::name;
+      std::string_view m_name;
+      std::size_t m_index = 0;
+   };
+
+   namespace internal
+   {
+      // A constexpr re-implementation of rules::key_rule that does not support escape sequences in quoted key parts.
+
+      [[nodiscard]] constexpr bool static_key_is_digit( const char c ) noexcept
+      {
+         return ( '0' <= c ) && ( c <= '9' );
+      }
+
+      template< typename F >
+      constexpr std::size_t static_key_parse( const std::string_view s, const F& f )
+      {
+         std::size_t n = 0;
+         std::size_t i = 0;
+
+         while( true ) {
+            if( i == s.size() ) {
+               throw std::invalid_argument( "static key part expected" );
+            }
+            const char c = s[ i ];
+
+            if( is_ident_first( c ) ) {
+               const std::size_t b = i;
+               while( ( ++i < s.size() ) && is_ident_other( s[ i ] ) ) {
+               }
+               f( static_key_part( s.substr( b, i - b ) ) );
+            }
+            else if( ( c == '"' ) || ( c == '\'' ) ) {
+               const std::size_t b = ++i;
+               while( ( i < s.size() ) && ( s[ i ] != c ) ) {
+                  if( s[ i ] == '\\' ) {
+                     throw std::invalid_argument( "escape sequences are not supported in static keys" );
+                  }
+                  if( static_cast< unsigned char >( s[ i ] ) < 0x20 ) {
+                     throw std::invalid_argument( "invalid control character in static key" );
+                  }
+                  ++i;
+               }
+               if( i == s.size() ) {
+                  throw std::invalid_argument( "unterminated quoted static key part" );
+               }
+               f( static_key_part( s.substr( b, i - b ) ) );
+               ++i;
+            }
+            else if( static_key_is_digit( c ) && ( n > 0 ) ) {
+               const std::size_t b = i;
+               std::size_t v = 0;
+               while( ( i < s.size() ) && static_key_is_digit( s[ i ] ) ) {
+                  if( i - b == 15 ) {
+                     throw std::invalid_argument( "static key index with more than 15 digits" );
+                  }
+                  v = v * 10 + std::size_t( s[ i ] - '0' );
+                  ++i;
+               }
+               f( static_key_part( v ) );
+            }
+            else {
+               throw std::invalid_argument( "invalid static key part" );
+            }
+            ++n;
+
+            if( i == s.size() ) {
+               return n;
+            }
+            if( s[ i ] != '.' ) {
+               throw std::invalid_argument( "invalid character in static key" );
+            }
+            ++i;
+         }
+      }
+
+      [[nodiscard]] constexpr std::size_t static_key_size( const std::string_view s )
+      {
+         return static_key_parse( s, []( const static_key_part& /*unused*/ ) {} );
+      }
+
+   }  // namespace internal
+
+   template< std::size_t N >
+   class static_key
+   {
+   public:
+      explicit constexpr static_key( const std::string_view s )
+      {
+         std::size_t i = 0;
+         internal::static_key_parse( s, [ & ]( const static_key_part& p ) {
+            if( i == N ) {
+               throw std::invalid_argument( "static key has too many parts" );
+            }
+            m_parts[ i++ ] = p;
+         } );
+         if( i != N ) {
+            throw std::invalid_argument( "static key has too few parts" );
+         }
+      }
+
+      [[nodiscard]] static constexpr std::size_t size() noexcept
+      {
+         return N;
+      }
+
+      [[nodiscard]] constexpr const static_key_part* begin() const noexcept
+      {
+         return m_parts.data();
+      }
+
+      [[nodiscard]] constexpr const static_key_part* end() const noexcept
+      {
+         return m_parts.data() + N;
+      }
+
+      [[nodiscard]] constexpr const static_key_part& operator[]( const std::size_t i ) const noexcept
+      {
+         return m_parts[ i ];
+      }
+
+      [[nodiscard]] key to_key() const
+      {
+         key result;
+         result.reserve( N );
+         for( const auto& p : m_parts ) {
+            switch( p.kind() ) {
+               case key_kind::name:
+                  result.emplace_back( std::string( p.get_name() ) );
+                  continue;
+               case key_kind::index:
+                  result.emplace_back( p.get_index() );
+                  continue;
+            }
+            throw std::logic_error( "code should be unreachable" );  // LCOV_EXCL_LINE
+         }
+         return result;
+      }
+
+   private:
+      std::array< static_key_part, N > m_parts = {};
+   };
+
+}  // namespace tao::config
+
+// Evaluates to a tao::config::static_key that was parsed and validated at compile time, invalid keys fail to compile.
+
+#define TAO_CONFIG_STATIC_KEY( StRiNg )                                                                          \
+   []() {                                                                                                        \
+      constexpr ::tao::config::static_key< ::tao::config::internal::static_key_size( StRiNg ) > tao_config_key( StRiNg ); \
+      return tao_config_key;                                                                                     \
+   }()
+
+#endif
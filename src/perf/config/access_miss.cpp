@@ -0,0 +1,70 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+// Usage: access_miss [count [rounds]] -- compares probing for count missing optional
+// keys with access() and catching the exception against try_access() and find().
+
+int main( int argc, char** argv )
+{
+   const std::size_t count = tao::config::bench_arg( argc, argv, 1, 10000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   std::string data;
+
+   for( std::size_t i = 0; i < 100; ++i ) {
+      data += "feature" + std::to_string( i ) + " = { enabled = true, weight = " + std::to_string( i ) + " }\n";
+   }
+   const auto config = tao::config::from_string( data, "perf" );
+
+   std::vector< tao::config::key > keys;
+   keys.reserve( count );
+
+   for( std::size_t i = 0; i < count; ++i ) {
+      keys.emplace_back( "feature" + std::to_string( i % 200 ) + ".enabled" );
+   }
+   std::size_t found1 = 0;
+   std::size_t found2 = 0;
+   std::size_t found3 = 0;
+
+   const double thrown = tao::config::bench( "access + catch", rounds, [ & ]() {
+      found1 = 0;
+      for( const auto& k : keys ) {
+         try {
+            (void)tao::config::access( config, k );
+            ++found1;
+         }
+         catch( const std::runtime_error& /*unused*/ ) {
+         }
+      }
+   } );
+   const double tried = tao::config::bench( "try_access", rounds, [ & ]() {
+      found2 = 0;
+      for( const auto& k : keys ) {
+         found2 += bool( tao::config::try_access( config, k ) );
+      }
+   } );
+   const double found = tao::config::bench( "find", rounds, [ & ]() {
+      found3 = 0;
+      for( const auto& k : keys ) {
+         found3 += ( tao::config::find( config, k ) != nullptr );
+      }
+   } );
+   std::cout << "speedup try_access: " << ( thrown / tried ) << std::endl;
+   std::cout << "speedup find: " << ( thrown / found ) << std::endl;
+
+   if( ( found1 != found2 ) || ( found1 != found3 ) ) {
+      std::cerr << "results differ!" << std::endl;
+      return 1;
+   }
+   return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#ifndef TAO_CONFIG_SRC_PERF_CONFIG_BENCH_HPP
+#define TAO_CONFIG_SRC_PERF_CONFIG_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace tao::config
+{
+   [[nodiscard]] inline std::size_t bench_arg( const int argc, char** argv, const int i, const std::size_t d )
+   {
+      return ( argc > i ) ? std::size_t( std::strtoull( argv[ i ], nullptr, 10 ) ) : d;
+   }
+
+   // Calls f() the given number of times and prints and returns the average duration in microseconds.
+
+   template< typename F >
+   double bench( const std::string& name, const std::size_t rounds, const F& f )
+   {
+      const auto start = std::chrono::steady_clock::now();
+      for( std::size_t i = 0; i < rounds; ++i ) {
+         f();
+      }
+      const auto stop = std::chrono::steady_clock::now();
+      const double us = std::chrono::duration< double, std::micro >( stop - start ).count() / double( rounds ? rounds : 1 );
+      std::cout << name << ": " << us << "us" << std::endl;
+      return us;
+   }
+
+}  // namespace tao::config
+
+// Programs that define TAO_CONFIG_PERF_COUNT_ALLOCATIONS before including this header replace the global
+// operator new and delete to count the allocations and to track the current and peak heap usage; every
+// allocation is prefixed with its size.
+
+#if defined( TAO_CONFIG_PERF_COUNT_ALLOCATIONS )
+
+namespace tao::config
+{
+   inline constexpr std::size_t bench_header = alignof( std::max_align_t );
+
+   inline std::size_t bench_allocations = 0;
+   inline std::size_t bench_current = 0;
+   inline std::size_t bench_peak = 0;
+
+}  // namespace tao::config
+
+void* operator new( const std::size_t size )
+{
+   if( auto* p = static_cast< char* >( std::malloc( size + tao::config::bench_header ) ) ) {
+      *reinterpret_cast< std::size_t* >( p ) = size;
+      ++tao::config::bench_allocations;
+      tao::config::bench_current += size;
+      tao::config::bench_peak = ( tao::config::bench_current > tao::config::bench_peak ) ? tao::config::bench_current : tao::config::bench_peak;
+      return p + tao::config::bench_header;
+   }
+   throw std::bad_alloc();
+}
+
+void operator delete( void* p ) noexcept
+{
+   if( p != nullptr ) {
+      char* q = static_cast< char* >( p ) - tao::config::bench_header;
+      tao::config::bench_current -= *reinterpret_cast< std::size_t* >( q );
+      std::free( q );
+   }
+}
+
+void operator delete( void* p, const std::size_t /*unused*/ ) noexcept
+{
+   operator delete( p );
+}
+
+#endif
+
+#endif
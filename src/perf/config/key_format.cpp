@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+namespace tao::config
+{
+   // The previous implementation that ran the identifier grammar on an input per name.
+
+   [[nodiscard]] bool grammar_is_identifier( const std::string& n )
+   {
+      using grammar = pegtl::seq< internal::rules::ident, pegtl::eof >;
+      pegtl::memory_input< pegtl::tracking_mode::lazy, pegtl::eol::lf_crlf, const char* > in( n, __FUNCTION__ );
+      return pegtl::parse< grammar >( in );
+   }
+
+   void grammar_to_stream( std::ostream& o, const key& k )
+   {
+      for( std::size_t i = 0; i < k.size(); ++i ) {
+         if( i > 0 ) {
+            o << '.';
+         }
+         if( k[ i ].kind() == key_kind::index ) {
+            o << k[ i ].get_index();
+         }
+         else if( grammar_is_identifier( k[ i ].get_name() ) ) {
+            o << k[ i ].get_name();
+         }
+         else {
+            o << '"' << json::internal::escape( k[ i ].get_name() ) << '"';
+         }
+      }
+   }
+
+}  // namespace tao::config
+
+// Usage: key_format [count [rounds]] -- compares formatting keys via the grammar and
+// a std::ostringstream per key with appending them all to a single reused buffer.
+
+int main( int argc, char** argv )
+{
+   const std::size_t count = tao::config::bench_arg( argc, argv, 1, 100000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   std::vector< tao::config::key > keys;
+   keys.reserve( count );
+
+   for( std::size_t i = 0; i < count; ++i ) {
+      tao::config::key k;
+      k.emplace_back( "section_" + std::to_string( i % 97 ) );
+      k.emplace_back( i % 13 );
+      k.emplace_back( ( i % 7 ) ? "some-member-name" : "quoted name" );
+      keys.emplace_back( std::move( k ) );
+   }
+   std::size_t size1 = 0;
+   std::size_t size2 = 0;
+
+   const double old = tao::config::bench( "grammar + ostringstream", rounds, [ & ]() {
+      size1 = 0;
+      for( const auto& k : keys ) {
+         std::ostringstream oss;
+         tao::config::grammar_to_stream( oss, k );
+         size1 += oss.str().size();
+      }
+   } );
+   std::string buffer;
+
+   const double now = tao::config::bench( "table + append_to_string", rounds, [ & ]() {
+      size2 = 0;
+      for( const auto& k : keys ) {
+         buffer.clear();
+         tao::config::append_to_string( buffer, k );
+         size2 += buffer.size();
+      }
+   } );
+   std::cout << "speedup: " << ( old / now ) << std::endl;
+
+   if( size1 != size2 ) {
+      std::cerr << "results differ!" << std::endl;
+      return 1;
+   }
+   return 0;
+}
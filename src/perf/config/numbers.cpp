@@ -0,0 +1,42 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+// Usage: numbers [scale [rounds]] -- parses a config with lookup tables of integers,
+// hexadecimal numbers and doubles, and the same config with all numbers replaced by
+// null; the difference is the time spent converting numbers.
+
+int main( int argc, char** argv )
+{
+   const std::size_t scale = tao::config::bench_arg( argc, argv, 1, 2000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   std::string numbers;
+   std::string nulls;
+
+   for( std::size_t i = 0; i < scale; ++i ) {
+      const std::string n = std::to_string( i );
+      numbers += "table" + n + " = [";
+      nulls += "table" + n + " = [";
+      for( std::size_t j = 0; j < 20; ++j ) {
+         const std::string m = std::to_string( i * 7919 + j * 104729 );
+         numbers += ' ' + m + ' ' + m + "12345678 -" + m + " 0x" + m + ' ' + m + ".25 " + m + "e-3";
+         nulls += " null null null null null null";
+      }
+      numbers += " ]\n";
+      nulls += " ]\n";
+   }
+   std::cout << "input size: " << numbers.size() << " bytes" << std::endl;
+
+   const double n = tao::config::bench( "numbers", rounds, [ & ]() { (void)tao::config::from_string( numbers, "perf" ); } );
+   const double z = tao::config::bench( "nulls", rounds, [ & ]() { (void)tao::config::from_string( nulls, "perf" ); } );
+   std::cout << "per number: " << ( ( n - z ) * 1000.0 / double( scale * 120 ) ) << "ns" << std::endl;
+   return 0;
+}
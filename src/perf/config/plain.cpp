@@ -0,0 +1,38 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+// Usage: plain [scale [rounds]] -- compares the plain fast path with the full pipeline
+// on a plain config made of scale copies of tests/jaxn.jaxn as members of the top-level.
+
+int main( int argc, char** argv )
+{
+   const std::size_t scale = tao::config::bench_arg( argc, argv, 1, 10000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   const std::string element = tao::config::internal::read_file_throws( "tests/jaxn.jaxn" );
+   std::string data;
+
+   for( std::size_t i = 0; i < scale; ++i ) {
+      data += "member" + std::to_string( i ) + " = " + element + '\n';
+   }
+   std::cout << "input size: " << data.size() << " bytes" << std::endl;
+
+   const double full = tao::config::bench( "from_string", rounds, [ & ]() { (void)tao::config::from_string( data, "perf" ); } );
+   const double plain = tao::config::bench( "from_plain_string", rounds, [ & ]() { (void)tao::config::from_plain_string( data, "perf", tao::config::plain_mode::require ); } );
+
+   std::cout << "speedup: " << ( full / plain ) << std::endl;
+
+   if( tao::config::from_string( data, "perf" ) != tao::config::from_plain_string( data, "perf", tao::config::plain_mode::require ) ) {
+      std::cerr << "results differ!" << std::endl;
+      return 1;
+   }
+   return 0;
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#define TAO_CONFIG_PERF_COUNT_ALLOCATIONS
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+// Usage: read_blob [mebibytes [rounds]] -- parses a config that embeds a file with the read
+// function and reports the time and the peak heap usage relative to the size of the file.
+
+int main( int argc, char** argv )
+{
+   const std::size_t size = tao::config::bench_arg( argc, argv, 1, 64 ) << 20;
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 5 );
+
+   const auto path = std::filesystem::temp_directory_path() / "tao-config-perf-read-blob.bin";
+   std::ofstream( path, std::ios::binary ) << std::string( size, 'x' );
+
+   const std::string data = "blob = (read \"" + path.generic_string() + "\")\n";
+
+   (void)tao::config::bench( "from_string", rounds, [ & ]() { (void)tao::config::from_string( data, "perf" ); } );
+
+   const std::size_t before = tao::config::bench_current;
+   tao::config::bench_peak = before;
+   const auto v = tao::config::from_string( data, "perf" );
+
+   std::cout << "peak heap: " << ( double( tao::config::bench_peak - before ) / double( size ) ) << " times the file size" << std::endl;
+   std::filesystem::remove( path );
+   return v.at( "blob" ).get_binary().size() == size ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#define TAO_CONFIG_PERF_COUNT_ALLOCATIONS
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+// Usage: strings [scale [rounds]] -- parses a config made of long string literals, binary
+// literals and quoted keys, and reports the time and the number of heap allocations.
+
+int main( int argc, char** argv )
+{
+   const std::size_t scale = tao::config::bench_arg( argc, argv, 1, 20000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   std::string data;
+
+   for( std::size_t i = 0; i < scale; ++i ) {
+      const std::string n = std::to_string( i );
+      data += "\"quoted key number " + n + " that is long\" = [ \"a string literal without any escape sequences " + n + "\" 'another single quoted string literal " + n + "' $0123456789abcdef0123456789abcdef0123456789 ]\n";
+   }
+   std::cout << "input size: " << data.size() << " bytes" << std::endl;
+
+   (void)tao::config::bench( "from_string", rounds, [ & ]() { (void)tao::config::from_string( data, "perf" ); } );
+
+   const std::size_t before = tao::config::bench_allocations;
+   const auto v = tao::config::from_string( data, "perf" );
+   const std::size_t after = tao::config::bench_allocations;
+
+   // Every member needs at least four allocations for the contents of its key, its two strings and its binary; the
+   // remaining allocations are for the entries, containers and positions and for the final JSON value.
+
+   std::cout << "allocations: " << ( after - before ) << " total, " << ( double( after - before ) / double( scale ) ) << " per member, at least 4 of which are for the contents" << std::endl;
+   return v.get_object().size() == scale ? 0 : 1;
+}
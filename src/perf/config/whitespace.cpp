@@ -0,0 +1,55 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <tao/config.hpp>
+
+#include "bench.hpp"
+
+namespace tao::config
+{
+   template< typename Rule >
+   [[nodiscard]] bool skip_all( const std::string& data )
+   {
+      pegtl_input_t in( data, "perf" );
+      return pegtl::parse< pegtl::seq< Rule, pegtl::eof > >( in );
+   }
+
+}  // namespace tao::config
+
+// Usage: whitespace [scale [rounds]] -- compares pegtl::star< jaxn::ws > with rules::wss
+// on the whitespace and comments of a pretty-printed and commented config, and reports
+// the time to parse the complete config with tao::config::from_string().
+
+int main( int argc, char** argv )
+{
+   const std::size_t scale = tao::config::bench_arg( argc, argv, 1, 20000 );
+   const std::size_t rounds = tao::config::bench_arg( argc, argv, 2, 10 );
+
+   std::string blank;
+   std::string data;
+
+   for( std::size_t i = 0; i < scale; ++i ) {
+      const std::string ws = "\n                // Settings for service " + std::to_string( i ) + ".\n                ";
+      const std::string cm = "   /* The weight of this service,\n                   relative to the others. */\n                ";
+      blank += ws + cm + "\n# end\n";
+      data += "service" + std::to_string( i ) + " = {" + ws + "name = \"n" + std::to_string( i ) + "\"" + ws + "weight = " + std::to_string( i ) + cm + "}\n# end\n";
+   }
+   std::cout << "input size: " << data.size() << " bytes, whitespace only: " << blank.size() << " bytes" << std::endl;
+
+   const double old = tao::config::bench( "star< jaxn::ws >", rounds, [ & ]() { (void)tao::config::skip_all< tao::pegtl::star< tao::config::internal::rules::jaxn::ws > >( blank ); } );
+   const double now = tao::config::bench( "rules::wss", rounds, [ & ]() { (void)tao::config::skip_all< tao::config::internal::rules::wss >( blank ); } );
+   std::cout << "speedup: " << ( old / now ) << std::endl;
+
+   const double full = tao::config::bench( "from_string", rounds, [ & ]() { (void)tao::config::from_string( data, "perf" ); } );
+   std::cout << "throughput: " << ( double( data.size() ) / full ) << " MB/s" << std::endl;
+
+   if( !tao::config::skip_all< tao::config::internal::rules::wss >( blank ) ) {
+      std::cerr << "whitespace not skipped!" << std::endl;
+      return 1;
+   }
+   return 0;
+}
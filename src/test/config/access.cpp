@@ -1,6 +1,8 @@
 // Copyright (c) 2021-2024 Dr. Colin Hirsch and Daniel Frey
 // Please see LICENSE for license or visit https://github.com/taocpp/config/
 
+#include <string>
+
 #include "test.hpp"
 
 #include <tao/config.hpp>
@@ -10,6 +12,7 @@ namespace tao::config
    void unit_test()
    {
       const auto v = from_string( "a = 1, b = 2, c = { d = { e = [ 6 7 ] } }", __FUNCTION__ );
+      const key i0 = { key_part( std::size_t( 0 ) ) };  // Key strings can not start with an index.
 
       TAO_CONFIG_TEST_ASSERT( access( v, key( "a" ) ) == value( 1 ) );
       TAO_CONFIG_TEST_ASSERT( access( v, key( "b" ) ) == value( 2 ) );
@@ -23,11 +26,45 @@ namespace tao::config
       TAO_CONFIG_TEST_ASSERT( access( v, key( "c.d.e.0" ) ).key == key( "c.d.e.0" ) );
       TAO_CONFIG_TEST_ASSERT( access( v, key( "c.d.e.1" ) ).key == key( "c.d.e.1" ) );
 
-      TAO_CONFIG_TEST_THROWS( (void)access( v, key( "0" ) ) );
+      TAO_CONFIG_TEST_THROWS( (void)access( v, i0 ) );
       TAO_CONFIG_TEST_THROWS( (void)access( v, key( "a.0" ) ) );
       TAO_CONFIG_TEST_THROWS( (void)access( v, key( "r" ) ) );
       TAO_CONFIG_TEST_THROWS( (void)access( v, key( "c.d.e.f" ) ) );
       TAO_CONFIG_TEST_THROWS( (void)access( v, key( "c.d.e.2" ) ) );
+
+      TAO_CONFIG_TEST_ASSERT( *try_access( v, key( "a" ) ) == value( 1 ) );
+      TAO_CONFIG_TEST_ASSERT( try_access( v, key( "c.d.e.1" ) )->key == key( "c.d.e.1" ) );
+      TAO_CONFIG_TEST_ASSERT( try_access( v, key( "c.d.e.1" ) ).error == access_error::success );
+      TAO_CONFIG_TEST_ASSERT( try_access( v, TAO_CONFIG_STATIC_KEY( "c.d.e.0" ) ).pointer == &access( v, key( "c.d.e.0" ) ) );
+
+      const auto r1 = try_access( v, i0 );
+      TAO_CONFIG_TEST_ASSERT( !r1 );
+      TAO_CONFIG_TEST_ASSERT( r1.error == access_error::not_an_array );
+      TAO_CONFIG_TEST_ASSERT( r1.part == 0 );
+      const auto r2 = try_access( v, key( "a.0" ) );
+      TAO_CONFIG_TEST_ASSERT( !r2 );
+      TAO_CONFIG_TEST_ASSERT( r2.error == access_error::not_an_array );
+      TAO_CONFIG_TEST_ASSERT( r2.part == 1 );
+      const auto r3 = try_access( v, key( "r" ) );
+      TAO_CONFIG_TEST_ASSERT( !r3 );
+      TAO_CONFIG_TEST_ASSERT( r3.error == access_error::name_not_found );
+      TAO_CONFIG_TEST_ASSERT( r3.part == 0 );
+      const auto r4 = try_access( v, key( "c.d.e.f" ) );
+      TAO_CONFIG_TEST_ASSERT( !r4 );
+      TAO_CONFIG_TEST_ASSERT( r4.error == access_error::not_an_object );
+      TAO_CONFIG_TEST_ASSERT( r4.part == 3 );
+      const auto r5 = try_access( v, key( "c.d.e.2" ) );
+      TAO_CONFIG_TEST_ASSERT( !r5 );
+      TAO_CONFIG_TEST_ASSERT( r5.error == access_error::index_out_of_bounds );
+      TAO_CONFIG_TEST_ASSERT( r5.part == 3 );
+      TAO_CONFIG_TEST_ASSERT( to_string( r5.error ) == "array index out of bounds" );
+
+      TAO_CONFIG_TEST_ASSERT( find( v, key( "c.d.e.1" ) ) == &access( v, key( "c.d.e.1" ) ) );
+      TAO_CONFIG_TEST_ASSERT( find( v, TAO_CONFIG_STATIC_KEY( "c.d" ) ) == &access( v, key( "c.d" ) ) );
+      TAO_CONFIG_TEST_ASSERT( find( v, key( "c.d.x" ) ) == nullptr );
+      TAO_CONFIG_TEST_ASSERT( find( v, key( "c.d.e.9" ) ) == nullptr );
+
+      TAO_CONFIG_TEST_ASSERT( internal::strcat( "x", 'y', std::size_t( 42 ), -1, std::string( "z" ), json::type::BOOLEAN ) == "xy42-1zboolean" );
    }
 
 }  // namespace tao::config
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   void unit_test()
+   {
+      const auto v = from_string( "a = 1, b = { c = 2, d = [ 3 4 ] }, e = { f = { g = 5 } }", __FUNCTION__ );
+
+      const std::vector< key > keys = { key( "e.f.g" ), key( "b.d.1" ), key( "a" ), key( "b.x" ), key( "b" ), key( "b.d.2" ), key( "a.z" ), key( "b.c" ), key( "e.f.g" ), key() };
+      const auto r = access_batch( v, keys );
+
+      TAO_CONFIG_TEST_ASSERT( r.size() == keys.size() );
+
+      for( std::size_t i = 0; i < keys.size(); ++i ) {
+         if( r[ i ] ) {
+            TAO_CONFIG_TEST_ASSERT( r[ i ].pointer == &access( v, keys[ i ] ) );
+            TAO_CONFIG_TEST_ASSERT( r[ i ].error.empty() );
+         }
+         else {
+            TAO_CONFIG_TEST_ASSERT( !r[ i ].error.empty() );
+            try {
+               (void)access( v, keys[ i ] );
+               TAO_CONFIG_TEST_UNREACHABLE;
+            }
+            catch( const std::runtime_error& e ) {
+               TAO_CONFIG_TEST_ASSERT( r[ i ].error == e.what() );
+            }
+         }
+      }
+      TAO_CONFIG_TEST_ASSERT( *r[ 0 ] == value( 5 ) );
+      TAO_CONFIG_TEST_ASSERT( *r[ 1 ] == value( 4 ) );
+      TAO_CONFIG_TEST_ASSERT( *r[ 2 ] == value( 1 ) );
+      TAO_CONFIG_TEST_ASSERT( r[ 3 ].error == "object index \"x\" not found" );
+      TAO_CONFIG_TEST_ASSERT( r[ 4 ]->is_object() );
+      TAO_CONFIG_TEST_ASSERT( r[ 5 ].error == "array index 2 out of bounds 2" );
+      TAO_CONFIG_TEST_ASSERT( r[ 6 ].error == "attempt to index non-object with \"z\"" );
+      TAO_CONFIG_TEST_ASSERT( *r[ 7 ] == value( 2 ) );
+      TAO_CONFIG_TEST_ASSERT( r[ 8 ].pointer == r[ 0 ].pointer );
+      TAO_CONFIG_TEST_ASSERT( r[ 9 ].pointer == &v );
+
+      TAO_CONFIG_TEST_ASSERT( access_batch( v, {} ).empty() );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
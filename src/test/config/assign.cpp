@@ -10,6 +10,7 @@ namespace tao::config
    void unit_test()
    {
       auto v = from_string( "a = 1, b = 2, c = { d = { e = [ 6 7 ] } }", __FUNCTION__ );
+      const key i0 = { key_part( std::size_t( 0 ) ) };  // Key strings can not start with an index.
 
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "a" ) ) == value( 1 ) );
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "b" ) ) == value( 2 ) );
@@ -23,13 +24,32 @@ namespace tao::config
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "c.d.e.0" ) ).key == key( "c.d.e.0" ) );
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "c.d.e.1" ) ).key == key( "c.d.e.1" ) );
 
-      TAO_CONFIG_TEST_THROWS( (void)assign( v, key( "0" ) ) );
+      TAO_CONFIG_TEST_THROWS( (void)assign( v, i0 ) );
       TAO_CONFIG_TEST_THROWS( (void)assign( v, key( "c.d.e.f" ) ) );
       TAO_CONFIG_TEST_THROWS( (void)assign( v, key( "c.d.e.2" ) ) );
       TAO_CONFIG_TEST_THROWS( (void)assign( v, key( "a.0" ) ) );
 
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "r" ) ) == value( json::empty_object ) );
       TAO_CONFIG_TEST_ASSERT( assign( v, key( "r.s.t" ) ) == value( json::empty_object ) );
+
+      TAO_CONFIG_TEST_ASSERT( *try_assign( v, key( "a" ) ) == value( 1 ) );
+      TAO_CONFIG_TEST_ASSERT( try_assign( v, key( "c.d.e.1" ) )->key == key( "c.d.e.1" ) );
+      TAO_CONFIG_TEST_ASSERT( try_assign( v, TAO_CONFIG_STATIC_KEY( "c.d.e.0" ) ).pointer == &assign( v, key( "c.d.e.0" ) ) );
+      TAO_CONFIG_TEST_ASSERT( *try_assign( v, key( "u.v" ) ) == value( json::empty_object ) );
+      TAO_CONFIG_TEST_ASSERT( find( v, key( "u.v" ) ) != nullptr );
+
+      const auto r1 = try_assign( v, i0 );
+      TAO_CONFIG_TEST_ASSERT( !r1 );
+      TAO_CONFIG_TEST_ASSERT( r1.error == access_error::not_an_array );
+      TAO_CONFIG_TEST_ASSERT( r1.part == 0 );
+      const auto r2 = try_assign( v, key( "c.d.e.f" ) );
+      TAO_CONFIG_TEST_ASSERT( !r2 );
+      TAO_CONFIG_TEST_ASSERT( r2.error == access_error::not_an_object );
+      TAO_CONFIG_TEST_ASSERT( r2.part == 3 );
+      const auto r3 = try_assign( v, key( "c.d.e.2" ) );
+      TAO_CONFIG_TEST_ASSERT( !r3 );
+      TAO_CONFIG_TEST_ASSERT( r3.error == access_error::index_out_of_bounds );
+      TAO_CONFIG_TEST_ASSERT( r3.part == 3 );
    }
 
 }  // namespace tao::config
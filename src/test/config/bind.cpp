@@ -0,0 +1,109 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   struct endpoint
+   {
+      std::string host;
+      std::uint16_t port = 0;
+   };
+
+   struct server
+   {
+      std::string name;
+      std::vector< endpoint > endpoints;
+      std::optional< endpoint > admin;
+      std::vector< std::string > tags;
+      bool verbose = false;
+   };
+
+   struct lenient
+   {
+      std::int64_t a = 0;
+   };
+
+   template<>
+   struct bind_traits< endpoint >
+   {
+      static constexpr auto fields = std::make_tuple( field( "host", &endpoint::host ),
+                                                      field( "port", &endpoint::port ) );
+   };
+
+   template<>
+   struct bind_traits< server >
+   {
+      static constexpr auto fields = std::make_tuple( field( "name", &server::name ),
+                                                      field( "endpoints", &server::endpoints ),
+                                                      optional_field( "admin", &server::admin ),
+                                                      optional_field( "tags", &server::tags ),
+                                                      optional_field( "verbose", &server::verbose ) );
+   };
+
+   template<>
+   struct bind_traits< lenient >
+   {
+      static constexpr auto fields = std::make_tuple( field( "a", &lenient::a ) );
+      static constexpr bool ignore_unknown = true;
+   };
+
+   [[nodiscard]] bool error_contains( const value& v, const std::string& part )
+   {
+      try {
+         (void)bind< server >( v );
+      }
+      catch( const std::exception& e ) {
+         return std::string( e.what() ).find( part ) != std::string::npos;
+      }
+      return false;
+   }
+
+   void unit_test()
+   {
+      const auto v = from_string( "name = \"main\", endpoints = [ { host = \"a\", port = 1 }, { host = \"b\", port = 2 } ], tags = [ \"x\" ]", __FUNCTION__ );
+      const auto s = bind< server >( v );
+      TAO_CONFIG_TEST_ASSERT( s.name == "main" );
+      TAO_CONFIG_TEST_ASSERT( s.endpoints.size() == 2 );
+      TAO_CONFIG_TEST_ASSERT( s.endpoints[ 0 ].host == "a" );
+      TAO_CONFIG_TEST_ASSERT( s.endpoints[ 0 ].port == 1 );
+      TAO_CONFIG_TEST_ASSERT( s.endpoints[ 1 ].host == "b" );
+      TAO_CONFIG_TEST_ASSERT( s.endpoints[ 1 ].port == 2 );
+      TAO_CONFIG_TEST_ASSERT( !s.admin );
+      TAO_CONFIG_TEST_ASSERT( s.tags == std::vector< std::string >{ "x" } );
+      TAO_CONFIG_TEST_ASSERT( !s.verbose );
+
+      const auto w = from_string( "name = \"n\", endpoints = [], admin = { host = \"h\", port = 3 }, verbose = true", __FUNCTION__ );
+      server t;
+      bind( w, t );
+      TAO_CONFIG_TEST_ASSERT( t.admin );
+      TAO_CONFIG_TEST_ASSERT( t.admin->host == "h" );
+      TAO_CONFIG_TEST_ASSERT( t.admin->port == 3 );
+      TAO_CONFIG_TEST_ASSERT( t.verbose );
+
+      // All errors contain the key and the position of the offending value.
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "endpoints = []", __FUNCTION__ ), "missing required member \"name\"  [(root):1:1]" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = \"n\", endpoints = [], nmae = 1", __FUNCTION__ ), "unknown member \"nmae\" nmae [unit_test:1:36]" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = \"n\", endpoints = [ { host = \"h\" } ]", __FUNCTION__ ), "missing required member \"port\" endpoints.0 [unit_test:1:27]" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = \"n\", endpoints = {}", __FUNCTION__ ), "for binding to array endpoints [unit_test:1:25]" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = 1, endpoints = []", __FUNCTION__ ), "invalid json type 'unsigned'" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = 1, endpoints = []", __FUNCTION__ ), " name [unit_test:1:8]" ) );
+      TAO_CONFIG_TEST_ASSERT( error_contains( from_string( "name = \"n\", endpoints = [ { host = \"h\", port = \"x\" } ]", __FUNCTION__ ), " endpoints.0.port [unit_test:1:48]" ) );
+
+      const auto l = bind< lenient >( from_string( "a = 4, b = 5", __FUNCTION__ ) );
+      TAO_CONFIG_TEST_ASSERT( l.a == 4 );
+      TAO_CONFIG_TEST_THROWS( (void)bind< lenient >( from_string( "b = 5", __FUNCTION__ ) ) );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
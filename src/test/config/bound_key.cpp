@@ -0,0 +1,49 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   void unit_test()
+   {
+      const auto v = from_string( "a = 1, b = 2, c = { d = { e = [ 6 7 ] } }", __FUNCTION__ );
+      const auto w = from_string( "c.d.e = [ 8 9 ]", __FUNCTION__ );
+
+      const key k( "c.d.e.1" );
+      TAO_CONFIG_TEST_ASSERT( &access( v, k.begin(), k.end() ) == &access( v, k ) );
+      TAO_CONFIG_TEST_ASSERT( &access( v, k.begin(), k.begin() + 3 ) == &access( v, key( "c.d.e" ) ) );
+      TAO_CONFIG_TEST_ASSERT( &access( v, k.begin(), k.begin() ) == &v );
+
+      bound_key b( k );
+      TAO_CONFIG_TEST_ASSERT( !b.is_bound() );
+      TAO_CONFIG_TEST_ASSERT( b.key() == k );
+
+      TAO_CONFIG_TEST_ASSERT( b.get( v ) == value( 7 ) );
+      TAO_CONFIG_TEST_ASSERT( b.is_bound() );
+      TAO_CONFIG_TEST_ASSERT( b.is_bound_to( v ) );
+      TAO_CONFIG_TEST_ASSERT( &b.get() == &access( v, k ) );
+      TAO_CONFIG_TEST_ASSERT( &access( v, b ) == &access( v, k ) );
+
+      TAO_CONFIG_TEST_ASSERT( b.get( w ) == value( 9 ) );
+      TAO_CONFIG_TEST_ASSERT( b.is_bound_to( w ) );
+      TAO_CONFIG_TEST_ASSERT( !b.is_bound_to( v ) );
+
+      b.unbind();
+      TAO_CONFIG_TEST_ASSERT( !b.is_bound() );
+
+      const bound_key c( v, "c.d.e.0" );
+      TAO_CONFIG_TEST_ASSERT( c.get() == value( 6 ) );
+      TAO_CONFIG_TEST_ASSERT( c.get().key == key( "c.d.e.0" ) );
+
+      bound_key d( "c.d.e.2" );
+      TAO_CONFIG_TEST_THROWS( (void)d.get( v ) );
+      TAO_CONFIG_TEST_ASSERT( !d.is_bound() );
+      TAO_CONFIG_TEST_THROWS( (void)bound_key( w, "a" ) );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -1,6 +1,10 @@
 // Copyright (c) 2022-2024 Dr. Colin Hirsch and Daniel Frey
 // Please see LICENSE for license or visit https://github.com/taocpp/config/
 
+#include <cstdint>
+#include <string>
+#include <string_view>
+
 #include "test.hpp"
 
 #include <tao/config.hpp>
@@ -8,14 +12,76 @@
 
 namespace tao::config
 {
+   [[nodiscard]] internal::string_t repeat( const pegtl::position& pos, const std::string_view s, const std::uint8_t n, const bool b )
+   {
+      std::string r;
+      for( std::uint8_t i = 0; i < n; ++i ) {
+         r += s;
+      }
+      return internal::string_t( b ? ( "[" + r + "]" ) : r, pos );
+   }
+
+   [[nodiscard]] internal::double_t scale( const pegtl::position& pos, const double d, const std::int64_t i )
+   {
+      return internal::double_t( d * double( i ), pos );
+   }
+
+   [[nodiscard]] internal::unsigned_t binary_size( const pegtl::position& pos, const tao::binary_view b )
+   {
+      return internal::unsigned_t( b.size(), pos );
+   }
+
+   [[nodiscard]] internal::string_t kind_name( const pegtl::position& pos, const internal::entry& e )
+   {
+      return internal::string_t( std::string( internal::to_string( e.kind() ) ), pos );
+   }
+
+   [[nodiscard]] internal::signed_t sum( const pegtl::position& pos, const int a, const int b, const int c, const int d, const int e, const int f, const int g, const int h, const int i, const int j )
+   {
+      return internal::signed_t( a + b + c + d + e + f + g + h + i + j, pos );
+   }
+
    void unit_test()
    {
-      parser p;
-      p.set_inner_extension( "rot13", rot13 );
-      p.parse( "a = (rot13 \"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ@[]{}`\")", __FUNCTION__ );
-      const auto j = p.result< json::traits >();
+      {
+         parser p;
+         p.set_inner_extension( "rot13", rot13 );
+         p.parse( "a = (rot13 \"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ@[]{}`\")", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "0123456789nopqrstuvwxyzabcdefghijklmNOPQRSTUVWXYZABCDEFGHIJKLM@[]{}`" );
+         TAO_CONFIG_TEST_THROWS( (void)p.result< json::traits >() );
+      }
+      {
+         parser p;
+         p.set_inner_extension( "repeat", repeat );
+         p.set_inner_extension( "scale", scale );
+         p.set_inner_extension( "size", binary_size );
+         p.set_inner_extension( "kind", kind_name );
+         p.set_inner_extension( "rot13", rot13 );
+         p.set_inner_extension( "sum", sum );
+         p.parse( "a = (repeat \"ab\" 3 true)\nb = (scale 1.5 -4)\nc = (size (binary \"abcd\"))\nd = (kind [ 1 ])\nf = (repeat (rot13 \"x\") 2 false)\ng = (sum 1 2 3 4 5 6 7 8 9 -10)", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
 
-      TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "0123456789nopqrstuvwxyzabcdefghijklmNOPQRSTUVWXYZABCDEFGHIJKLM@[]{}`" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "[ababab]" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == -6.0 );
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ) == 4U );
+         TAO_CONFIG_TEST_ASSERT( j.at( "d" ) == "array" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "f" ) == "kk" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "g" ) == 35 );
+      }
+      {
+         parser p;
+         p.set_inner_extension( "repeat", repeat );
+         p.parse( "a = (repeat \"ab\" 300 true)", __FUNCTION__ );
+         TAO_CONFIG_TEST_THROWS( p.result< json::traits >() );
+      }
+      {
+         parser p;
+         p.set_inner_extension( "repeat", repeat );
+         p.parse( "a = (repeat \"ab\" 3)", __FUNCTION__ );
+         TAO_CONFIG_TEST_THROWS( p.result< json::traits >() );
+      }
    }
 
 }  // namespace tao::config
@@ -0,0 +1,53 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <iostream>
+#include <string>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   // Returns the error message, including the position, of parsing the given config.
+
+   [[nodiscard]] std::string error( const std::string& s )
+   {
+      try {
+         (void)from_string( s, "decode" );
+      }
+      catch( const pegtl::parse_error& e ) {
+         return e.what();
+      }
+      return "no error";  // LCOV_EXCL_LINE
+   }
+
+   void check( const std::string& s, const std::string& e )
+   {
+      const std::string r = error( s );
+      if( r != e ) {
+         // LCOV_EXCL_START
+         ++failed;
+         std::cerr << "decode error mismatch for '" << s << "': '" << r << "' instead of '" << e << "'" << std::endl;
+         // LCOV_EXCL_STOP
+      }
+   }
+
+   void unit_test()
+   {
+      // Errors in verbatim string literals are reported at the invalid character...
+      check( "foo = (base64 \"SGVs*bG8=\")", "decode:1:20: invalid character in base64 data at offset 4" );
+      check( "foo = (base64 'SGVs*bG8=')", "decode:1:20: invalid character in base64 data at offset 4" );
+      check( "foo = 1\nbar = (hex \"4865xx\")", "decode:2:17: invalid character in hex data at offset 4" );
+      check( "foo = (hex \"48656\")", "decode:1:18: incomplete hex data" );
+
+      // ...all other errors at the argument.
+      check( "foo = (base64 \"\\u0053GVs*bG8=\")", "decode:1:15: invalid character in base64 data at offset 4" );
+      check( "foo = (base64 '''SGVs*bG8=''')", "decode:1:15: invalid character in base64 data at offset 4" );
+      check( "foo = (hex $34383635787878)", "decode:1:12: invalid character in hex data at offset 4" );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <memory>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+#include "setenv.hpp"
+
+namespace tao::config
+{
+   void unit_test()
+   {
+      {
+         parser p;
+         p.set_environment( std::make_shared< const environment >( environment::map_t{ { "HOST", "example.org" }, { "PORT", "8080" } } ) );
+         p.parse( "a = (env \"HOST\")\nb = (parse (env \"PORT\"))\nc = (env? \"USER\" \"nobody\")", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "example.org" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == 8080 );
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ) == "nobody" );
+      }
+      {
+         parser p;
+         p.set_environment( std::make_shared< const environment >() );
+         p.parse( "a = (env \"PATH\")", __FUNCTION__ );
+         TAO_CONFIG_TEST_THROWS( (void)p.result< json::traits >() );
+      }
+      {
+         internal::setenv_throws( "TAO_CONFIG_SNAPSHOT", "1" );
+         parser p;
+         p.parse( "a = (env \"TAO_CONFIG_SNAPSHOT\")\nb = (env? \"TAO_CONFIG_SNAPSHOT\" \"2\")", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "1" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == "1" );
+      }
+      {
+         // A snapshot is not affected by later changes to the process environment.
+         const auto env = environment::snapshot();
+         internal::setenv_throws( "TAO_CONFIG_SNAPSHOT", "3" );
+         TAO_CONFIG_TEST_ASSERT( *env->find( "TAO_CONFIG_SNAPSHOT" ) == "1" );
+         TAO_CONFIG_TEST_ASSERT( env->find( "TAO_CONFIG_NO_SUCH_VARIABLE" ) == nullptr );
+      }
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <memory>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   void unit_test()
+   {
+      const auto expected = from_file( "tests/include.success" );
+      const auto cache = std::make_shared< file_cache >();
+      {
+         parser p;
+         p.set_file_cache( cache );
+         p.parse( "tests/include.success" );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >() == expected );
+      }
+      TAO_CONFIG_TEST_ASSERT( cache->size() == 2 );
+      TAO_CONFIG_TEST_ASSERT( cache->misses() == 2 );
+      TAO_CONFIG_TEST_ASSERT( cache->hits() == 2 );
+      {
+         parser p;
+         p.set_file_cache( cache );
+         p.parse( "tests/include.success" );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >() == expected );
+      }
+      TAO_CONFIG_TEST_ASSERT( cache->size() == 2 );
+      TAO_CONFIG_TEST_ASSERT( cache->misses() == 2 );
+      TAO_CONFIG_TEST_ASSERT( cache->hits() == 6 );
+      {
+         const auto c = std::make_shared< file_cache >();
+         internal::include_prefetch f( c, 2 );
+         f.scan( "(include \"tests/include.success\")" );
+         f.wait_all();
+         TAO_CONFIG_TEST_ASSERT( c->misses() == 2 );  // Both files were read by the workers, recursively.
+         parser p;
+         p.set_file_cache( c );
+         p.parse( "tests/include.success" );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >() == expected );
+         TAO_CONFIG_TEST_ASSERT( c->misses() == 2 );  // The parser found all files in the cache.
+      }
+      {
+         parser p;
+         p.set_include_prefetch( true, 1 );
+         p.parse( "tests/include.success" );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >() == expected );
+      }
+      {
+         parser p;
+         p.set_include_prefetch( true );
+         p.set_file_cache( cache );
+         p.parse( "tests/doc_include.success" );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >() == from_file( "tests/doc_include.success" ) );
+      }
+      TAO_CONFIG_TEST_ASSERT( cache->size() == 4 );
+      {
+         parser p;
+         p.set_file_cache( cache );
+         TAO_CONFIG_TEST_THROWS( p.parse( "tests/non_existing_file" ) );
+      }
+      {
+         parser p;
+         p.set_file_cache( cache );
+         TAO_CONFIG_TEST_THROWS( p.parse( "(include \"tests/non_existing_file\")", __FUNCTION__ ) );
+      }
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
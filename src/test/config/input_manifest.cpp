@@ -0,0 +1,70 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   const std::string missing = "a b c d e f g h i j k l m n o p q r s t u v w x y z";
+
+   [[nodiscard]] const input_record* find( const std::vector< input_record >& inputs, const input_kind kind, const std::string& name )
+   {
+      for( const auto& i : inputs ) {
+         if( ( i.kind == kind ) && ( i.name == name ) ) {
+            return &i;
+         }
+      }
+      return nullptr;  // LCOV_EXCL_LINE
+   }
+
+   void unit_test()
+   {
+      static_assert( internal::fnv1a( "" ) == 0xcbf29ce484222325ULL );
+      static_assert( internal::fnv1a( "a" ) == 0xaf63dc4c8601ec8cULL );
+
+      const auto manifest = std::make_shared< input_manifest >();
+
+      parser p;
+      p.set_input_manifest( manifest );
+      p.parse( "tests/include.success" );
+      p.parse( "foo = (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"x\")\nbar = (read \"tests/doc_include.inc\")\nbaz = (read \"tests/simple.success\")", __FUNCTION__ );
+      (void)p.result< traits >();
+
+      // Files that are parsed or included come first, in the order in which they are reached.
+
+      const auto& inputs = manifest->inputs();
+      TAO_CONFIG_TEST_ASSERT( inputs.size() == 5 );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 0 ].kind == input_kind::file );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 0 ].name == "tests/include.success" );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 0 ].hash == internal::fnv1a( internal::read_file_throws( "tests/include.success" ) ) );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 1 ].kind == input_kind::file );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 1 ].name == "tests/simple.success" );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 1 ].hash == internal::fnv1a( internal::read_file_throws( "tests/simple.success" ) ) );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 2 ].kind == input_kind::file );
+      TAO_CONFIG_TEST_ASSERT( inputs[ 2 ].name == missing );
+      TAO_CONFIG_TEST_ASSERT( !inputs[ 2 ].hash );
+
+      // The inputs of function calls follow in an unspecified order.
+
+      const auto* env = find( inputs, input_kind::environment, "TAO_CONFIG_NO_SUCH_VARIABLE" );
+      const auto* read = find( inputs, input_kind::file, "tests/doc_include.inc" );
+      TAO_CONFIG_TEST_ASSERT( ( env == &inputs[ 3 ] ) || ( env == &inputs[ 4 ] ) );
+      TAO_CONFIG_TEST_ASSERT( ( read == &inputs[ 3 ] ) || ( read == &inputs[ 4 ] ) );
+      TAO_CONFIG_TEST_ASSERT( env && !env->hash );
+      TAO_CONFIG_TEST_ASSERT( read && ( read->hash == internal::fnv1a( internal::read_file_throws( "tests/doc_include.inc" ) ) ) );
+
+      // The only file that is read by a function is last, the missing file gets an empty rule.
+
+      const std::string escaped = "a\\ b\\ c\\ d\\ e\\ f\\ g\\ h\\ i\\ j\\ k\\ l\\ m\\ n\\ o\\ p\\ q\\ r\\ s\\ t\\ u\\ v\\ w\\ x\\ y\\ z";
+      TAO_CONFIG_TEST_ASSERT( manifest->to_depfile( "out/my config.json" ) == "out/my\\ config.json: \\\n  tests/include.success \\\n  tests/simple.success \\\n  " + escaped + " \\\n  tests/doc_include.inc\n\n" + escaped + ":\n" );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   void unit_test()
+   {
+      const key_chain e;
+      TAO_CONFIG_TEST_ASSERT( e.empty() );
+      TAO_CONFIG_TEST_ASSERT( e.size() == 0 );
+      TAO_CONFIG_TEST_ASSERT( e == key() );
+      TAO_CONFIG_TEST_ASSERT( e.to_key().empty() );
+      TAO_CONFIG_TEST_ASSERT( to_string( e ).empty() );
+
+      const key_chain a = e + "a";
+      const key_chain b = a + 1;
+      const key_chain c = b + "c d";
+      TAO_CONFIG_TEST_ASSERT( c.size() == 3 );
+      TAO_CONFIG_TEST_ASSERT( c.back() == key_part( "c d" ) );
+      TAO_CONFIG_TEST_ASSERT( c.parent() == b );
+      TAO_CONFIG_TEST_ASSERT( c == key( "a.1.'c d'" ) );
+      TAO_CONFIG_TEST_ASSERT( key( "a.1.'c d'" ) == c );
+      TAO_CONFIG_TEST_ASSERT( c != key( "a.1" ) );
+      TAO_CONFIG_TEST_ASSERT( c != key( "a.2.'c d'" ) );
+      TAO_CONFIG_TEST_ASSERT( c == key_chain( key( "a.1.'c d'" ) ) );
+      TAO_CONFIG_TEST_ASSERT( c != a + 1 + "c e" );
+      TAO_CONFIG_TEST_ASSERT( to_string( c ) == "a.1.\"c d\"" );
+      TAO_CONFIG_TEST_ASSERT( to_string( c ) == to_string( key( "a.1.'c d'" ) ) );
+
+      const key k = c;
+      TAO_CONFIG_TEST_ASSERT( k == key( "a.1.'c d'" ) );
+
+      const auto v = from_string( "a = { b = [ 1 { c = 2 } ] }", __FUNCTION__ );
+      const auto& x = access( v, key( "a.b.1.c" ) );
+      TAO_CONFIG_TEST_ASSERT( x.key == key( "a.b.1.c" ) );
+      TAO_CONFIG_TEST_ASSERT( x.key.parent() == access( v, key( "a.b.1" ) ).key );
+      TAO_CONFIG_TEST_ASSERT( to_string( x.key ) == "a.b.1.c" );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
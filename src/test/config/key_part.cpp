@@ -46,11 +46,46 @@ namespace tao::config
       TAO_CONFIG_TEST_ASSERT( oss.str() == "42" );
    }
 
+   void test_identifier()
+   {
+      static_assert( is_identifier( "foo" ) );
+      static_assert( is_identifier( "_f-0" ) );
+      static_assert( !is_identifier( "" ) );
+      static_assert( !is_identifier( "0a" ) );
+      static_assert( !is_identifier( "-a" ) );
+      static_assert( !is_identifier( "a.b" ) );
+      static_assert( !is_identifier( "a b" ) );
+      TAO_CONFIG_TEST_ASSERT( !is_identifier( std::string( "a\0b", 3 ) ) );
+      TAO_CONFIG_TEST_ASSERT( !is_identifier( "\xc3\xa4" ) );
+   }
+
+   void test_escape()
+   {
+      const key_part p( std::string( "\"\\\n\t\x01\x7f\xc3\xa4" ) );
+      const std::string expected = "\"\\\"\\\\\\n\\t\\u0001\\u007f\xc3\xa4\"";
+      TAO_CONFIG_TEST_ASSERT( to_string( p ) == expected );
+      std::ostringstream oss;
+      to_stream( oss, p );
+      TAO_CONFIG_TEST_ASSERT( oss.str() == expected );
+   }
+
+   void test_append()
+   {
+      std::string s = "x";
+      append_to_string( s, key_part( "foo" ) );
+      append_to_string( s, key_part( std::size_t( 4294967295U ) ) );
+      append_to_string( s, key_part( "a b" ) );
+      TAO_CONFIG_TEST_ASSERT( s == "xfoo4294967295\"a b\"" );
+   }
+
    void unit_test()
    {
       test_name1();
       test_name2();
       test_index();
+      test_identifier();
+      test_escape();
+      test_append();
    }
 
 }  // namespace tao::config
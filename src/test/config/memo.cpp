@@ -0,0 +1,97 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstddef>
+#include <string>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+#include <tao/config/contrib/rot13.hpp>
+
+namespace tao::config
+{
+   std::size_t calls = 0;
+
+   [[nodiscard]] internal::string_t counted_rot13( const pegtl::position& pos, const std::string& in )
+   {
+      ++calls;
+      return rot13( pos, in );
+   }
+
+   // Returns an array whose elements have the position of the call, like most functions with nested results.
+
+   [[nodiscard]] internal::entry twice( const pegtl::position& pos, const std::string& in )
+   {
+      internal::entry r( internal::array_init, pos );
+      for( std::size_t i = 0; i < 2; ++i ) {
+         r.get_array().array.emplace_back( pos ).concat.emplace_back( internal::string_t( in, pos ) );
+      }
+      return r;
+   }
+
+   const std::string input = "a = (rot13 \"x\")\nb = (rot13 \"x\")\nc = [ (rot13 \"x\"), (rot13 \"y\") ]";
+
+   void unit_test()
+   {
+      {
+         parser p;
+         p.set_inner_extension( "rot13", counted_rot13, true );
+         p.parse( input, __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ) == "k" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == "k" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ).at( 0 ) == "k" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ).at( 1 ) == "l" );
+         TAO_CONFIG_TEST_ASSERT( calls == 2 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_hits() == 2 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_misses() == 2 );
+      }
+      calls = 0;
+      {
+         parser p;
+         p.set_inner_extension( "rot13", counted_rot13 );
+         p.parse( input, __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ).at( 0 ) == "k" );
+         TAO_CONFIG_TEST_ASSERT( calls == 4 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_hits() == 0 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_misses() == 0 );
+      }
+      {
+         parser p;
+         p.parse( "a = (split \"x y\")\nb = (split \"x y\")\nc = (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"d\")\nd = (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"d\")\ne = (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"e\")", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == j.at( "a" ) );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ).at( 1 ) == "y" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "d" ) == "d" );
+         TAO_CONFIG_TEST_ASSERT( j.at( "e" ) == "e" );
+         TAO_CONFIG_TEST_ASSERT( p.memo_hits() == 2 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_misses() == 3 );
+      }
+      {
+         parser p;
+         p.parse( "a = (parse (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"[ 1, { b: 2 } ]\"))\nb = (parse (env? \"TAO_CONFIG_NO_SUCH_VARIABLE\" \"[ 1, { b: 2 } ]\"))\nc = (parse \"[ 1, { b: 2 } ]\")", __FUNCTION__ );
+         const auto j = p.result< json::traits >();
+         TAO_CONFIG_TEST_ASSERT( j.at( "a" ).at( 1 ).at( "b" ) == 2 );
+         TAO_CONFIG_TEST_ASSERT( j.at( "b" ) == j.at( "a" ) );
+         TAO_CONFIG_TEST_ASSERT( j.at( "c" ) == j.at( "a" ) );
+         TAO_CONFIG_TEST_ASSERT( p.memo_hits() == 3 );
+         TAO_CONFIG_TEST_ASSERT( p.memo_misses() == 2 );
+      }
+      {
+         parser p;
+         p.set_inner_extension( "twice", twice, true );
+         p.parse( "a = (twice \"x\")\nb = (twice \"x\")", __FUNCTION__ );
+         const auto v = p.result< traits >();
+         TAO_CONFIG_TEST_ASSERT( p.memo_hits() == 1 );
+         TAO_CONFIG_TEST_ASSERT( v.at( "a" ).at( 1 ).position.line() == 1 );
+         TAO_CONFIG_TEST_ASSERT( v.at( "b" ).position.line() == 2 );
+         TAO_CONFIG_TEST_ASSERT( v.at( "b" ).at( 0 ).position.line() == 2 );
+         TAO_CONFIG_TEST_ASSERT( v.at( "b" ).at( 1 ).position.line() == 2 );
+      }
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,55 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   // The fixtures in tests/numbers2.* compare with JSON files where signed and unsigned
+   // integers are indistinguishable, these tests check the type of the boundary values.
+
+   [[nodiscard]] value number( const std::string& s )
+   {
+      return from_string( "n = " + s, __FUNCTION__ ).at( "n" );
+   }
+
+   void unit_test()
+   {
+      TAO_CONFIG_TEST_ASSERT( number( "0" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "0" ).get_unsigned() == 0 );
+      TAO_CONFIG_TEST_ASSERT( number( "-0" ).is_signed() );
+      TAO_CONFIG_TEST_ASSERT( number( "-0" ).get_signed() == 0 );
+
+      TAO_CONFIG_TEST_ASSERT( number( "9223372036854775807" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "9223372036854775807" ).get_unsigned() == 9223372036854775807ULL );
+      TAO_CONFIG_TEST_ASSERT( number( "9223372036854775808" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "9223372036854775808" ).get_unsigned() == 9223372036854775808ULL );
+      TAO_CONFIG_TEST_ASSERT( number( "18446744073709551615" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "18446744073709551615" ).get_unsigned() == std::numeric_limits< std::uint64_t >::max() );
+      TAO_CONFIG_TEST_ASSERT( number( "+9999999999999999999" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "+9999999999999999999" ).get_unsigned() == 9999999999999999999ULL );
+
+      TAO_CONFIG_TEST_ASSERT( number( "-9223372036854775807" ).is_signed() );
+      TAO_CONFIG_TEST_ASSERT( number( "-9223372036854775807" ).get_signed() == -9223372036854775807LL );
+      TAO_CONFIG_TEST_ASSERT( number( "-9223372036854775808" ).is_signed() );
+      TAO_CONFIG_TEST_ASSERT( number( "-9223372036854775808" ).get_signed() == std::numeric_limits< std::int64_t >::min() );
+      TAO_CONFIG_TEST_ASSERT( number( "-9223372036854775809" ).is_double() );
+
+      TAO_CONFIG_TEST_ASSERT( number( "0xffffffffffffffff" ).is_unsigned() );
+      TAO_CONFIG_TEST_ASSERT( number( "0xffffffffffffffff" ).get_unsigned() == std::numeric_limits< std::uint64_t >::max() );
+      TAO_CONFIG_TEST_ASSERT( number( "-0x8000000000000000" ).is_signed() );
+      TAO_CONFIG_TEST_ASSERT( number( "-0x8000000000000000" ).get_signed() == std::numeric_limits< std::int64_t >::min() );
+
+      TAO_CONFIG_TEST_ASSERT( number( "1.5" ).is_double() );
+      TAO_CONFIG_TEST_ASSERT( number( "-0.0" ).is_double() );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
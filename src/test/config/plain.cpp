@@ -0,0 +1,104 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "setenv.hpp"
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   [[nodiscard]] std::string annotation_string( const value& v )
+   {
+      std::ostringstream oss;
+      v.append_message_extension( oss );
+      return oss.str();
+   }
+
+   [[nodiscard]] bool same_annotations( const value& l, const value& r )
+   {
+      if( annotation_string( l ) != annotation_string( r ) ) {
+         std::cerr << "Annotation mismatch: " << annotation_string( l ) << " vs. " << annotation_string( r ) << std::endl;  // LCOV_EXCL_LINE
+         return false;  // LCOV_EXCL_LINE
+      }
+      if( l.is_array() && r.is_array() && ( l.get_array().size() == r.get_array().size() ) ) {
+         for( std::size_t i = 0; i < l.get_array().size(); ++i ) {
+            if( !same_annotations( l.get_array()[ i ], r.get_array()[ i ] ) ) {
+               return false;  // LCOV_EXCL_LINE
+            }
+         }
+      }
+      if( l.is_object() && r.is_object() ) {
+         for( const auto& [ k, v ] : l.get_object() ) {
+            if( const auto j = r.get_object().find( k ); ( j == r.get_object().end() ) || !same_annotations( v, j->second ) ) {
+               return false;  // LCOV_EXCL_LINE
+            }
+         }
+      }
+      return true;
+   }
+
+   void unit_test( const std::filesystem::path& path, unsigned& plain )
+   {
+      const auto source = path.string();
+      const auto data = internal::read_file_throws( source );
+      const auto full = from_file( path );
+      const auto detect = from_plain_file( path );
+
+      TAO_CONFIG_TEST_ASSERT( detect == full );
+      TAO_CONFIG_TEST_ASSERT( same_annotations( detect, full ) );
+
+      try {
+         const auto fast = internal::plain_parse< traits >( pegtl_input_t( data, source ) );
+         TAO_CONFIG_TEST_ASSERT( fast == full );
+         TAO_CONFIG_TEST_ASSERT( same_annotations( fast, full ) );
+         TAO_CONFIG_TEST_ASSERT( from_plain_file( path, plain_mode::require ) == full );
+         ++plain;
+      }
+      catch( const pegtl::parse_error& ) {
+         TAO_CONFIG_TEST_THROWS( (void)from_plain_file( path, plain_mode::require ) );
+      }
+   }
+
+   void unit_test()
+   {
+      TAO_CONFIG_TEST_ASSERT( from_plain_string( "a.b = 1, a.c: [ 2 { d.e = 3 } ], f = { g = 'h' }, a.b = true", __FUNCTION__, plain_mode::require ) == from_string( "a.b = 1, a.c: [ 2 { d.e = 3 } ], f = { g = 'h' }, a.b = true", __FUNCTION__ ) );
+      TAO_CONFIG_TEST_ASSERT( from_plain_string( "{ \"a\": 1, 'b c': [], d: $ff }", __FUNCTION__, plain_mode::require ) == from_string( "{ \"a\": 1, 'b c': [], d: $ff }", __FUNCTION__ ) );
+      TAO_CONFIG_TEST_ASSERT( from_plain_string( "", __FUNCTION__, plain_mode::require ) == from_string( "", __FUNCTION__ ) );
+
+      TAO_CONFIG_TEST_THROWS( (void)from_plain_string( "a = 1 + 2", __FUNCTION__, plain_mode::require ) );
+      TAO_CONFIG_TEST_THROWS( (void)from_plain_string( "a = (env \"TAO_CONFIG\")", __FUNCTION__, plain_mode::require ) );
+      TAO_CONFIG_TEST_THROWS( (void)from_plain_string( "a = [ 1 ], a.0 = 2", __FUNCTION__, plain_mode::require ) );
+      TAO_CONFIG_TEST_THROWS( (void)from_plain_string( "a = 1, a.b = 2", __FUNCTION__, plain_mode::require ) );
+      TAO_CONFIG_TEST_THROWS( (void)from_plain_string( "a = 1, a.b = 2", __FUNCTION__ ) );
+
+      TAO_CONFIG_TEST_ASSERT( from_plain_string( "a = [ 1 ], a += [ 2 ]", __FUNCTION__ ) == from_string( "a = [ 1 2 ]", __FUNCTION__ ) );
+      TAO_CONFIG_TEST_ASSERT( from_plain_string( "a = 1, b = (a)", __FUNCTION__ ) == from_string( "a = 1, b = 1", __FUNCTION__ ) );
+
+      unsigned plain = 0;
+
+      for( const auto& entry : std::filesystem::directory_iterator( "tests" ) ) {
+         if( const auto& path = entry.path(); ( path.extension() == ".success" ) || ( path.extension() == ".jaxn" ) ) {
+#if defined( _MSC_VER )
+            if( entry.path().stem() == "shell" ) {
+               continue;
+            }
+#endif
+            internal::setenv_throws( "TAO_CONFIG", "env_value" );
+            unit_test( path, plain );
+         }
+         else if( path.extension() == ".failure" ) {
+            TAO_CONFIG_TEST_THROWS( (void)from_plain_file( path ) );
+         }
+      }
+      TAO_CONFIG_TEST_ASSERT( plain > 0 );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
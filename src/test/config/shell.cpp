@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+#if !defined( _MSC_VER )
+   const std::string sleepers = "a = (shell \"sh tests/shell_sleep.sh 0.4 a\")\n"
+                                "b = (shell \"sh tests/shell_sleep.sh 0.4 b\")\n"
+                                "c = [ (shell \"sh tests/shell_sleep.sh 0.4 c\") ]\n"
+                                "d = { e = (shell \"sh tests/shell_sleep.sh 0.4 e\") }\n";
+
+   [[nodiscard]] std::chrono::steady_clock::duration run_sleepers( const std::size_t limit )
+   {
+      const auto start = std::chrono::steady_clock::now();
+      parser p;
+      p.set_shell_concurrency( limit );
+      p.parse( sleepers, __FUNCTION__ );
+      const auto v = p.result< traits >();
+      const auto duration = std::chrono::steady_clock::now() - start;
+      TAO_CONFIG_TEST_ASSERT( v.at( "a" ).get_string() == "a\n" );
+      TAO_CONFIG_TEST_ASSERT( v.at( "b" ).get_string() == "b\n" );
+      TAO_CONFIG_TEST_ASSERT( v.at( "c" ).at( 0 ).get_string() == "c\n" );
+      TAO_CONFIG_TEST_ASSERT( v.at( "d" ).at( "e" ).get_string() == "e\n" );
+      return duration;
+   }
+
+   void unit_test()
+   {
+      // Only the lower bound of the serial run is exact, the concurrent run is compared relative to it.
+      const auto serial = run_sleepers( 1 );
+      const auto concurrent = run_sleepers( 4 );
+      TAO_CONFIG_TEST_ASSERT( serial >= std::chrono::milliseconds( 1600 ) );
+      TAO_CONFIG_TEST_ASSERT( concurrent * 2 < serial );
+      {
+         parser p;
+         p.parse( "a = (shell (shell \"echo echo hi\"))", __FUNCTION__ );
+         TAO_CONFIG_TEST_ASSERT( p.result< traits >().at( "a" ).get_string() == "hi\n" );
+      }
+      {
+         parser p;
+         p.parse( "a = (shell \"echo oops >&2; exit 3\")", __FUNCTION__ );
+         try {
+            (void)p.result< traits >();
+            TAO_CONFIG_TEST_UNREACHABLE;
+         }
+         catch( const pegtl::parse_error& e ) {
+            TAO_CONFIG_TEST_ASSERT( e.message() == "shell script failed with exit status 3 -- oops" );
+         }
+      }
+      {
+         parser p;
+         p.set_shell_max_output( 1000 );
+         p.parse( "a = (shell \"head -c 1000 /dev/zero\")\nb = (shell \"yes\")", __FUNCTION__ );
+         TAO_CONFIG_TEST_THROWS( p.result< traits >() );
+      }
+      {
+         parser p;
+         p.set_shell_max_output( 1000 );
+         p.set_shell_binary_output( true );
+         p.parse( "a = (shell \"head -c 1000 /dev/zero\")\nb = (string (shell \"echo hi\"))", __FUNCTION__ );
+         const auto v = p.result< traits >();
+         TAO_CONFIG_TEST_ASSERT( v.at( "a" ).get_binary() == std::vector< std::byte >( 1000 ) );
+         TAO_CONFIG_TEST_ASSERT( v.at( "b" ).get_string() == "hi\n" );
+      }
+      {
+         const auto start = std::chrono::steady_clock::now();
+         parser p;
+         p.set_shell_timeout( std::chrono::milliseconds( 200 ) );
+         p.parse( "a = (shell \"sh tests/shell_sleep.sh 0.1 a\")\nb = (shell \"sh tests/shell_sleep.sh 30 b\")", __FUNCTION__ );
+         TAO_CONFIG_TEST_THROWS( p.result< traits >() );
+         TAO_CONFIG_TEST_ASSERT( std::chrono::steady_clock::now() - start < std::chrono::seconds( 15 ) );
+      }
+   }
+#else
+   void unit_test()
+   {
+   }
+#endif
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,81 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   template< typename T >
+   [[nodiscard]] std::string extension( const T& t )
+   {
+      std::ostringstream oss;
+      t.append_message_extension( oss );
+      return oss.str();
+   }
+
+   void compare( const value& v, const sparse_value& s )
+   {
+      TAO_CONFIG_TEST_ASSERT( s.has_annotation() );
+      TAO_CONFIG_TEST_ASSERT( s.get_key() == v.key );
+      TAO_CONFIG_TEST_ASSERT( extension( s ) == extension( v ) );
+
+      if( v.is_array() && s.is_array() && ( v.get_array().size() == s.get_array().size() ) ) {
+         for( std::size_t i = 0; i < v.get_array().size(); ++i ) {
+            compare( v.get_array()[ i ], s.get_array()[ i ] );
+         }
+      }
+      if( v.is_object() && s.is_object() && ( v.get_object().size() == s.get_object().size() ) ) {
+         for( const auto& [ k, w ] : v.get_object() ) {
+            compare( w, s.get_object().at( k ) );
+         }
+      }
+   }
+
+   void unit_test()
+   {
+      const std::string input = "a = 1, b = { c = [ true, null, 'x' ], d.e = 2.5 }, f = (a)";
+      const auto v = from_string( input, __FUNCTION__ );
+      const auto s = basic_from_string< sparse_traits >( input, __FUNCTION__ );
+      const auto p = basic_from_plain_string< sparse_traits >( "a.b = 1, c = [ 2 ]", __FUNCTION__, plain_mode::require );
+
+      TAO_CONFIG_TEST_ASSERT( json::jaxn::to_string( v ) == json::jaxn::to_string( s ) );
+      compare( v, s );
+      compare( from_string( "a.b = 1, c = [ 2 ]", __FUNCTION__ ), p );
+
+      static_assert( sizeof( sparse_annotation ) == sizeof( std::uint32_t ) );
+
+      sparse_value c = s.at( "b" ).at( "c" );
+      sparse_value r;
+      {
+         const auto t = basic_from_string< sparse_traits >( input, __FUNCTION__ );
+         r = t;  // A copy of the root keeps the annotation table alive.
+         c = t.at( "b" ).at( "c" );
+      }
+      compare( v, r );
+      compare( v.at( "b" ).at( "c" ), c );
+      r = sparse_value( 0 );
+      TAO_CONFIG_TEST_ASSERT( !c.has_annotation() );  // Sub-values do not.
+      TAO_CONFIG_TEST_ASSERT( c.get_key().empty() );
+
+      const sparse_value e = sparse_value( 42 );
+      TAO_CONFIG_TEST_ASSERT( !e.has_annotation() );
+      TAO_CONFIG_TEST_ASSERT( e.get_key().empty() );
+
+      try {
+         (void)s.as< std::string >();
+         ++failed;  // LCOV_EXCL_LINE
+      }
+      catch( const std::exception& x ) {
+         TAO_CONFIG_TEST_ASSERT( x.what() == std::string( "invalid json type 'object' for conversion to std::string  [(root):1:1]" ) );
+      }
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
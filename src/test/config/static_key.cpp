@@ -0,0 +1,51 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   constexpr auto k1 = TAO_CONFIG_STATIC_KEY( "c.d.e.1" );
+   constexpr auto k2 = TAO_CONFIG_STATIC_KEY( "foo.'b a r'.\"baz\".42" );
+
+   static_assert( k1.size() == 4 );
+   static_assert( k1[ 0 ].kind() == key_kind::name );
+   static_assert( k1[ 0 ].get_name() == "c" );
+   static_assert( k1[ 3 ].kind() == key_kind::index );
+   static_assert( k1[ 3 ].get_index() == 1 );
+
+   static_assert( k2.size() == 4 );
+   static_assert( k2[ 1 ].get_name() == "b a r" );
+   static_assert( k2[ 2 ].get_name() == "baz" );
+   static_assert( k2[ 3 ].get_index() == 42 );
+
+   void unit_test()
+   {
+      TAO_CONFIG_TEST_ASSERT( k1.to_key() == key( "c.d.e.1" ) );
+      TAO_CONFIG_TEST_ASSERT( k2.to_key() == key( "foo.'b a r'.baz.42" ) );
+
+      auto v = from_string( "a = 1, b = 2, c = { d = { e = [ 6 7 ] } }", __FUNCTION__ );
+
+      TAO_CONFIG_TEST_ASSERT( access( v, k1 ) == value( 7 ) );
+      TAO_CONFIG_TEST_ASSERT( &access( v, k1 ) == &access( v, key( "c.d.e.1" ) ) );
+      TAO_CONFIG_TEST_ASSERT( access( v, TAO_CONFIG_STATIC_KEY( "a" ) ) == value( 1 ) );
+      TAO_CONFIG_TEST_THROWS( (void)access( v, TAO_CONFIG_STATIC_KEY( "c.d.e.2" ) ) );
+      TAO_CONFIG_TEST_THROWS( (void)access( v, TAO_CONFIG_STATIC_KEY( "a.b" ) ) );
+
+      TAO_CONFIG_TEST_ASSERT( &assign( v, k1 ) == &access( v, k1 ) );
+      TAO_CONFIG_TEST_ASSERT( assign( v, TAO_CONFIG_STATIC_KEY( "r.s.t" ) ) == value( json::empty_object ) );
+      TAO_CONFIG_TEST_ASSERT( access( v, key( "r.s" ) ).get_object().size() == 1 );
+      TAO_CONFIG_TEST_THROWS( (void)assign( v, TAO_CONFIG_STATIC_KEY( "c.d.e.2" ) ) );
+
+      TAO_CONFIG_TEST_THROWS( (void)internal::static_key_size( "" ) );
+      TAO_CONFIG_TEST_THROWS( (void)internal::static_key_size( "1" ) );
+      TAO_CONFIG_TEST_THROWS( (void)internal::static_key_size( "a..b" ) );
+      TAO_CONFIG_TEST_THROWS( (void)internal::static_key_size( "a.'\\n'" ) );
+      TAO_CONFIG_TEST_THROWS( (void)static_key< 1 >( "a.b" ) );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
@@ -0,0 +1,88 @@
+// Copyright (c) 2024 Dr. Colin Hirsch and Daniel Frey
+// Please see LICENSE for license or visit https://github.com/taocpp/config/
+
+#include <sstream>
+#include <string>
+
+#include "test.hpp"
+
+#include <tao/config.hpp>
+
+namespace tao::config
+{
+   // Returns the result and the position after matching Rule, or the error message.
+
+   template< typename Rule >
+   [[nodiscard]] std::string skip( const std::string& s )
+   {
+      pegtl_input_t in( s, "whitespace" );
+      try {
+         const bool b = pegtl::parse< Rule >( in );
+         const auto p = in.position();
+         return std::to_string( b ) + ' ' + std::to_string( p.byte ) + ':' + std::to_string( p.line ) + ':' + std::to_string( p.column );
+      }
+      catch( const pegtl::parse_error& e ) {
+         return e.what();
+      }
+   }
+
+   void compare( const std::string& s )
+   {
+      const std::string a = skip< internal::rules::wss >( s );
+      const std::string b = skip< pegtl::star< internal::rules::jaxn::ws > >( s );
+      if( a != b ) {
+         // LCOV_EXCL_START
+         ++failed;
+         std::cerr << "whitespace position mismatch for '" << s << "': '" << a << "' instead of '" << b << "'" << std::endl;
+         // LCOV_EXCL_STOP
+      }
+   }
+
+   [[nodiscard]] std::string extensions( const value& v )
+   {
+      std::ostringstream oss;
+      v.append_message_extension( oss );
+      for( const auto& [ k, w ] : v.get_object() ) {
+         w.append_message_extension( oss );
+      }
+      return oss.str();
+   }
+
+   void unit_test()
+   {
+      compare( "" );
+      compare( "x" );
+      compare( " \t\r\n \n\n\t x" );
+      compare( "\r\n\r\n  \r\n x" );
+      compare( "\r \r\n\r" );
+      compare( std::string( 15, ' ' ) + 'x' );
+      compare( std::string( 16, ' ' ) + 'x' );
+      compare( std::string( 17, ' ' ) + 'x' );
+      compare( std::string( 40, ' ' ) + "\n" + std::string( 33, ' ' ) + "\t x" );
+      compare( "# comment\r\n  // comment\n\t x" );
+      compare( "# comment without end" );
+      compare( "/* block */ /**/ /*/ still */ x" );
+      compare( "/* block\r\n over\n\n several\r\n lines */\r\n\t  x" );
+      compare( "/* block\n with \t tab */ # comment \t\r\n x" );
+      compare( "/* \xc3\xa4 non-ASCII\n block */\n x" );
+      compare( "# \xc3\xa4 non-ASCII\r\n x" );
+      compare( "/* unterminated\n block" );
+      compare( "/ x" );
+      compare( "# bad \x01 comment\n" );
+
+      // Block comments that are identical except for a non-ASCII character that makes the
+      // bulk skipper leave them to jaxn::ws must lead to the same annotations.
+
+      const std::string input = "\r\n/* c\r\n cc */  a = 1 /* a\r\n b */\r\n\t\tb = 2 # cc\r\n" + std::string( 20, ' ' ) + "/*\n\ncc*/ c = 3\r\n";
+      std::string other = input;
+      for( auto i = other.find( "cc" ); i != std::string::npos; i = other.find( "cc", i ) ) {
+         other.replace( i, 2, "\xc3\xa4" );
+      }
+      TAO_CONFIG_TEST_ASSERT( other != input );
+      TAO_CONFIG_TEST_ASSERT( other.size() == input.size() );
+      TAO_CONFIG_TEST_ASSERT( extensions( from_string( input, __FUNCTION__ ) ) == extensions( from_string( other, __FUNCTION__ ) ) );
+   }
+
+}  // namespace tao::config
+
+#include "main.hpp"
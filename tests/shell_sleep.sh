@@ -0,0 +1,4 @@
+#!/bin/sh
+# Stub script for src/test/config/shell.cpp: sleeps for $1 seconds, then prints $2.
+sleep "$1"
+echo "$2"